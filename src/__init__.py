@@ -1,4 +1,5 @@
 # -*- coding: utf-8 -*-
+import asyncio, functools
 from dcore import *
 
 MAINNET_ENDPOINT = 'wss://api.decent.ch'
@@ -8,6 +9,27 @@ WALLET_FILE = Path.instance().home + '/wallet.json'
 CORE_ASSET_ID = AssetId(ObjectId(1,3,0))
 CORE_UNIT_PRICE = Price.unit_price(CORE_ASSET_ID)
 
+def _with_timeout(method):
+    @functools.wraps(method)
+    def call(self, *args, timeout = None, **kwargs):
+        if timeout is None:
+            return method(self, *args, **kwargs)
+        with Deadline(timeout):
+            return method(self, *args, **kwargs)
+    return call
+
+# calls that do not wait for the node or the wallet, the *_async and iter_* methods neither
+_NON_BLOCKING = {'connect', 'connect_pool', 'pool_status', 'start_recording', 'stop_recording', 'replay', 'stop_replay',
+                 'stats', 'reset_stats', 'stats_prometheus', 'broadcast_queue', 'reference_block_provider',
+                 'enable_cache', 'disable_cache', 'clear_cache', 'cache_stats', 'subscribe_blocks', 'subscribe_irreversible'}
+
+# every blocking Wallet call accepts timeout = seconds, raising Timeout once it expires; the
+# request itself is not cancelled on the node, only its result is dropped
+for _name, _method in list(vars(Wallet).items()):
+    if _name.startswith(('_', 'iter_')) or _name.endswith('_async') or _name in _NON_BLOCKING or not callable(_method):
+        continue
+    setattr(Wallet, _name, _with_timeout(_method))
+
 def _wallet(wallet_file, endpoint):
     w = Wallet()
     w.connect(wallet_file, endpoint)
@@ -16,6 +38,28 @@ def _wallet(wallet_file, endpoint):
 Wallet.mainnet = staticmethod(lambda wallet_file = WALLET_FILE: _wallet(wallet_file, MAINNET_ENDPOINT))
 Wallet.testnet = staticmethod(lambda wallet_file = WALLET_FILE: _wallet(wallet_file, TESTNET_ENDPOINT))
 
+class AsyncWallet:
+    """Asyncio front-end of a wallet.
+
+       Database queries and broadcasts are awaited natively through the Wallet.*_async
+       methods, any other call runs in the default executor of the event loop.
+    """
+    def __init__(self, wallet):
+        self.wallet = wallet
+
+    def __getattr__(self, name):
+        method = getattr(self.wallet, name + '_async', None)
+        if method is not None:
+            return method
+
+        method = getattr(self.wallet, name)
+        if not callable(method):
+            return method
+
+        async def call(*args, **kwargs):
+            return await asyncio.get_running_loop().run_in_executor(None, functools.partial(method, *args, **kwargs))
+        return call
+
 def dump_accounts_balances(wallet):
     for name, id in wallet.lookup_accounts('', wallet.get_account_count()).items():
         print(f'{name}:', ', '.join([b.pretty_amount for b in wallet.list_account_balances(str(id))]))
@@ -5,7 +5,7 @@ namespace dcore {
 
 void register_account()
 {
-    bp::class_<graphene::chain::authority>("Authority", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::authority>("Authority", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::authority>)
         .def_readwrite("weight_threshold", &graphene::chain::authority::weight_threshold)
         .add_property("account_auths",
@@ -18,7 +18,7 @@ void register_account()
         .staticmethod("null_authority")
     ;
 
-    bp::class_<graphene::chain::account_options>("AccountOptions", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::account_options>("AccountOptions", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::account_options>)
         .def_readwrite("memo_key", &graphene::chain::account_options::memo_key)
         .def_readwrite("voting_account", &graphene::chain::account_options::voting_account)
@@ -31,7 +31,7 @@ void register_account()
             decode_set<graphene::chain::account_options, boost::container::flat_set<graphene::chain::vote_id_type>, &graphene::chain::account_options::votes>)
     ;
 
-    bp::class_<graphene::chain::publishing_rights>("PublishingRights", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::publishing_rights>("PublishingRights", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::publishing_rights>)
         .def_readwrite("is_publishing_manager", &graphene::chain::publishing_rights::is_publishing_manager)
         .add_property("publishing_rights_received",
@@ -21,19 +21,19 @@ void encode_extension_type(graphene::chain::asset_options& obj, const V &v)
 
 void register_asset()
 {
-    bp::class_<graphene::chain::price_feed>("PriceFeed", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::price_feed>("PriceFeed", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::price_feed>)
         .def_readwrite("core_exchange_rate", &graphene::chain::price_feed::core_exchange_rate)
     ;
 
     typedef std::pair<fc::time_point_sec, graphene::chain::price_feed> price_feed_time;
-    bp::class_<price_feed_time>("PriceFeedTime", bp::init<>())
+    def_bytes(bp::class_<price_feed_time>("PriceFeedTime", bp::init<>()))
         .def("__repr__", object_repr<price_feed_time>)
         .def_readwrite("time", &price_feed_time::first)
         .def_readwrite("feed", &price_feed_time::second)
     ;
 
-    bp::class_<graphene::chain::monitored_asset_options>("MonitoredAssetOptions", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::monitored_asset_options>("MonitoredAssetOptions", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::monitored_asset_options>)
         .add_property("feeds",
             encode_dict<graphene::chain::monitored_asset_options, boost::container::flat_map<graphene::chain::account_id_type, price_feed_time>, &graphene::chain::monitored_asset_options::feeds>,
@@ -44,7 +44,7 @@ void register_asset()
         .def_readwrite("minimum_feeds", &graphene::chain::monitored_asset_options::minimum_feeds)
     ;
 
-    bp::class_<graphene::chain::asset_options>("AssetOptions", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_options>("AssetOptions", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_options>)
         .add_property("max_supply",
             decode_safe_type<graphene::chain::asset_options, int64_t, &graphene::chain::asset_options::max_supply>,
@@ -16,13 +16,106 @@ void encode_smart_ref(T& obj, V v)
     (obj.*instance) = std::move(v);
 }
 
+// The fee schedule split into one single parameter schedule per operation tag, so the fee of an
+// operation is found by indexing instead of searching the parameter set. It is never modified
+// once compiled and may be shared between threads.
+class compiled_fee_schedule
+{
+public:
+    explicit compiled_fee_schedule(const graphene::chain::fee_schedule& schedule)
+    {
+        auto table = std::make_shared<std::vector<graphene::chain::fee_schedule>>(graphene::chain::operation::count());
+        for(auto& entry : *table)
+            entry.scale = schedule.scale;
+        for(const auto& param : schedule.parameters)
+            (*table)[param.which()].parameters.insert(param);
+        m_table = table;
+    }
+
+    graphene::chain::asset calculate_fee(const graphene::chain::operation& op, const graphene::chain::price& core_exchange_rate) const
+    {
+        return entry(op).calculate_fee(op, core_exchange_rate);
+    }
+
+    graphene::chain::asset set_fee(graphene::chain::operation& op, const graphene::chain::price& core_exchange_rate) const
+    {
+        return entry(op).set_fee(op, core_exchange_rate);
+    }
+
+    // The operations are copied and the fees computed without the GIL, so other Python threads
+    // sharing the compiled schedule run meanwhile.
+    bp::list calculate_fees(const bp::list& ops, const graphene::chain::price& core_exchange_rate) const
+    {
+        std::vector<graphene::chain::operation> copies = extract_operations(ops);
+        std::vector<graphene::chain::asset> fees(copies.size());
+        {
+            gil_release nogil;
+            for(std::size_t i = 0; i < copies.size(); ++i)
+                fees[i] = calculate_fee(copies[i], core_exchange_rate);
+        }
+        return fee_list(fees);
+    }
+
+    // sets the fee of every operation in place, the fees are written back once the GIL is held again
+    bp::list set_fees(const bp::list& ops, const graphene::chain::price& core_exchange_rate) const
+    {
+        // the items are kept referenced, the list itself may change meanwhile
+        std::vector<bp::object> items;
+        std::vector<graphene::chain::operation> copies;
+        for(bp::ssize_t i = 0; i < bp::len(ops); ++i) {
+            items.push_back(ops[i]);
+            copies.push_back(bp::extract<graphene::chain::operation&>(items.back())());
+        }
+
+        std::vector<graphene::chain::asset> fees(copies.size());
+        {
+            gil_release nogil;
+            for(std::size_t i = 0; i < copies.size(); ++i)
+                fees[i] = set_fee(copies[i], core_exchange_rate);
+        }
+        for(std::size_t i = 0; i < copies.size(); ++i)
+            bp::extract<graphene::chain::operation&>(items[i])() = std::move(copies[i]);
+        return fee_list(fees);
+    }
+
+private:
+    static std::vector<graphene::chain::operation> extract_operations(const bp::list& ops)
+    {
+        std::vector<graphene::chain::operation> copies;
+        copies.reserve(bp::len(ops));
+        for(bp::ssize_t i = 0; i < bp::len(ops); ++i)
+            copies.push_back(bp::extract<const graphene::chain::operation&>(ops[i])());
+        return copies;
+    }
+
+    static bp::list fee_list(const std::vector<graphene::chain::asset>& fees)
+    {
+        bp::list l;
+        for(const auto& fee : fees)
+            l.append(fee);
+        return l;
+    }
+
+    const graphene::chain::fee_schedule& entry(const graphene::chain::operation& op) const
+    {
+        return (*m_table)[op.which()];
+    }
+
+    std::shared_ptr<const std::vector<graphene::chain::fee_schedule>> m_table;
+};
+
+compiled_fee_schedule compile_fee_schedule(const graphene::chain::fee_schedule& schedule)
+{
+    return compiled_fee_schedule(schedule);
+}
+
 void register_chain()
 {
-    bp::class_<graphene::chain::fee_parameters>("FeeParameters", bp::no_init)
+    def_bytes(bp::class_<graphene::chain::fee_parameters>("FeeParameters", bp::no_init))
         .def("__repr__", object_repr<graphene::chain::fee_parameters>)
     ;
 
-    bp::class_<graphene::chain::fee_schedule>("FeeSchedule", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::fee_schedule>("FeeSchedule", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::fee_schedule>)
         .add_property("parameters",
             encode_set<graphene::chain::fee_schedule, boost::container::flat_set<graphene::chain::fee_parameters>, &graphene::chain::fee_schedule::parameters>,
@@ -32,9 +125,17 @@ void register_chain()
         .def("set_fee", &graphene::chain::fee_schedule::set_fee)
         .def("get_default", graphene::chain::fee_schedule::get_default)
         .staticmethod("get_default")
+        .def("compile", compile_fee_schedule)
+    ;
+
+    bp::class_<compiled_fee_schedule>("CompiledFeeSchedule", bp::no_init)
+        .def("calculate_fee", &compiled_fee_schedule::calculate_fee, (bp::arg("op"), bp::arg("core_exchange_rate") = graphene::chain::price::unit_price()))
+        .def("set_fee", &compiled_fee_schedule::set_fee, (bp::arg("op"), bp::arg("core_exchange_rate") = graphene::chain::price::unit_price()))
+        .def("calculate_fees", &compiled_fee_schedule::calculate_fees, (bp::arg("ops"), bp::arg("core_exchange_rate") = graphene::chain::price::unit_price()))
+        .def("set_fees", &compiled_fee_schedule::set_fees, (bp::arg("ops"), bp::arg("core_exchange_rate") = graphene::chain::price::unit_price()))
     ;
 
-    bp::class_<graphene::chain::chain_parameters>("ChainParameters", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::chain_parameters>("ChainParameters", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::chain_parameters>)
         .add_property("current_fees",
             decode_smart_ref<graphene::chain::chain_parameters, graphene::chain::fee_schedule, &graphene::chain::chain_parameters::current_fees>,
@@ -59,7 +160,7 @@ void register_chain()
         .def_readwrite("max_authority_depth", &graphene::chain::chain_parameters::max_authority_depth)
     ;
 
-    bp::class_<graphene::chain::immutable_chain_parameters>("ChainImmutableParameters", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::immutable_chain_parameters>("ChainImmutableParameters", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::immutable_chain_parameters>)
         .def_readwrite("min_miner_count", &graphene::chain::immutable_chain_parameters::min_miner_count)
         .def_readwrite("num_special_accounts", &graphene::chain::immutable_chain_parameters::num_special_accounts)
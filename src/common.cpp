@@ -7,10 +7,17 @@
 #include <graphene/utilities/key_conversion.hpp>
 #include <graphene/utilities/keys_generator.hpp>
 #include <decent/encrypt/encryptionutils.hpp>
+#include <fc/crypto/aes.hpp>
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <unordered_map>
 
 namespace dcore {
 
 PyObject *exception_class = nullptr;
+PyObject *timeout_class = nullptr;
 
 void exception_translator(const fc::exception &e)
 {
@@ -20,7 +27,7 @@ void exception_translator(const fc::exception &e)
 template<typename T>
 void register_hash(const char* name)
 {
-    bp::class_<T>(name, bp::init<>())
+    def_bytes(bp::class_<T>(name, bp::init<>()))
         .def(bp::init<std::string>())
         .def("__repr__", object_repr<T>)
         .def("__str__", &T::operator std::string)
@@ -31,7 +38,7 @@ void register_hash(const char* name)
 template<typename T>
 void register_object_id(const char* name)
 {
-    bp::class_<T>(name, bp::init<uint64_t>())
+    def_bytes(bp::class_<T>(name, bp::init<uint64_t>()))
         .def(bp::init<graphene::db::object_id_type>())
         .def("__repr__", object_repr<T>)
         .def("__str__", object_id_str<T>)
@@ -71,11 +78,740 @@ std::string get_public_el_gamal_key(const decent::encrypt::DIntegerString &el_ga
     return decent::encrypt::get_public_el_gamal_key(el_gamal).to_string();
 }
 
-graphene::chain::signature_type sign_transaction(graphene::chain::signed_transaction& trx,
+// The digests of a transaction are cached in its instance dictionary, once per version: the
+// bound setters and mutating methods drop them. The packed bytes are not kept, to_bytes packs
+// the transaction again.
+bp::dict digest_cache(const bp::object& trx)
+{
+    bp::dict d = bp::extract<bp::dict>(trx.attr("__dict__"));
+    if(!d.has_key("_digests"))
+        d["_digests"] = bp::dict();
+    return bp::extract<bp::dict>(d["_digests"]);
+}
+
+void invalidate_digests(const bp::object& trx)
+{
+    bp::dict d = bp::extract<bp::dict>(trx.attr("__dict__"));
+    if(d.has_key("_digests"))
+        bp::api::delitem(d, "_digests");
+}
+
+template<typename R, R (graphene::chain::transaction::* method)() const>
+bp::object cached_digest(const bp::object& trx, const char* key)
+{
+    bp::dict cache = digest_cache(trx);
+    if(!cache.has_key(key))
+        cache[key] = (bp::extract<const graphene::chain::transaction&>(trx)().*method)();
+    return cache[key];
+}
+
+bp::object transaction_digest(const bp::object& trx)
+{
+    return cached_digest<graphene::chain::digest_type, &graphene::chain::transaction::digest>(trx, "digest");
+}
+
+bp::object transaction_id(const bp::object& trx)
+{
+    return cached_digest<graphene::chain::transaction_id_type, &graphene::chain::transaction::id>(trx, "id");
+}
+
+std::string signature_digest_key(const graphene::chain::chain_id_type& chain_id)
+{
+    return "signature:" + std::string(chain_id);
+}
+
+bp::object transaction_signature_digest(const bp::object& trx, const graphene::chain::chain_id_type& chain_id)
+{
+    bp::dict cache = digest_cache(trx);
+    std::string key = signature_digest_key(chain_id);
+    if(!cache.has_key(key))
+        cache[key] = bp::extract<const graphene::chain::transaction&>(trx)().sig_digest(chain_id);
+    return cache[key];
+}
+
+graphene::chain::digest_type signature_digest(const bp::object& trx, const graphene::chain::chain_id_type& chain_id)
+{
+    return bp::extract<graphene::chain::digest_type>(transaction_signature_digest(trx, chain_id));
+}
+
+
+template<typename V, V graphene::chain::transaction::* member>
+void set_transaction_member(const bp::object& trx, const V& v)
+{
+    graphene::chain::transaction& t = bp::extract<graphene::chain::transaction&>(trx);
+    t.*member = v;
+    invalidate_digests(trx);
+}
+
+void set_operations(const bp::object& trx, const bp::list& l)
+{
+    decode_list<graphene::chain::transaction, std::vector<graphene::chain::operation>, &graphene::chain::transaction::operations>(bp::extract<graphene::chain::transaction&>(trx), l);
+    invalidate_digests(trx);
+}
+
+void set_reference_block(const bp::object& trx, const graphene::chain::block_id_type& block_id)
+{
+    graphene::chain::transaction& t = bp::extract<graphene::chain::transaction&>(trx);
+    t.set_reference_block(block_id);
+    invalidate_digests(trx);
+}
+
+graphene::chain::signature_type sign_transaction(const bp::object& trx,
                                                  const graphene::chain::private_key_type& key,
                                                  const graphene::chain::chain_id_type& chain_id)
 {
-    return trx.sign(key, chain_id);
+    graphene::chain::signed_transaction& t = bp::extract<graphene::chain::signed_transaction&>(trx);
+    t.signatures.push_back(key.sign_compact(signature_digest(trx, chain_id)));
+    return t.signatures.back();
+}
+
+// the digest is taken from the cache, keys appearing more than once sign once
+bp::list sign_many(const bp::object& trx, const bp::list& keys, const graphene::chain::chain_id_type& chain_id)
+{
+    graphene::chain::signed_transaction& t = bp::extract<graphene::chain::signed_transaction&>(trx);
+    graphene::chain::digest_type digest = signature_digest(trx, chain_id);
+    std::vector<graphene::chain::private_key_type> unique_keys;
+    std::set<graphene::chain::public_key_type> seen;
+    for(const auto& key : vector_from_list<graphene::chain::private_key_type>(keys)) {
+        if(seen.insert(key.get_public_key()).second)
+            unique_keys.push_back(key);
+    }
+
+    std::vector<graphene::chain::signature_type> signatures(unique_keys.size());
+    {
+        gil_release nogil;
+        // signing a few keys is cheaper than starting threads
+        parallel_for(unique_keys.size(), unique_keys.size() < 4 ? 1 : 0, [&](std::size_t i) {
+            signatures[i] = unique_keys[i].sign_compact(digest);
+        });
+    }
+
+    bp::list l;
+    for(const auto& signature : signatures) {
+        t.signatures.push_back(signature);
+        l.append(signature);
+    }
+    return l;
+}
+
+fc::optional<graphene::chain::public_key_type> recover_key(const graphene::chain::signature_type& signature, const graphene::chain::digest_type& digest)
+{
+    try {
+        return graphene::chain::public_key_type(fc::ecc::public_key(signature, digest));
+    }
+    catch(const fc::exception&) {
+        return {};
+    }
+}
+
+std::vector<fc::optional<graphene::chain::public_key_type>> recover_keys(const graphene::chain::signed_transaction& trx,
+                                                                         const graphene::chain::digest_type& digest, unsigned threads)
+{
+    std::vector<fc::optional<graphene::chain::public_key_type>> keys(trx.signatures.size());
+    parallel_for(keys.size(), threads, [&](std::size_t i) { keys[i] = recover_key(trx.signatures[i], digest); });
+    return keys;
+}
+
+bp::list to_key_list(const std::vector<fc::optional<graphene::chain::public_key_type>>& keys)
+{
+    bp::list l;
+    for(const auto& key : keys)
+        l.append(encode_optional_value(key));
+    return l;
+}
+
+// the keys recovered from the signatures in order, None for an invalid signature
+bp::list get_signature_keys(const bp::object& trx, const graphene::chain::chain_id_type& chain_id)
+{
+    const graphene::chain::signed_transaction& t = bp::extract<const graphene::chain::signed_transaction&>(trx);
+    graphene::chain::digest_type digest = signature_digest(trx, chain_id);
+    std::vector<fc::optional<graphene::chain::public_key_type>> keys;
+    {
+        gil_release nogil;
+        keys = recover_keys(t, digest, t.signatures.size() < 4 ? 1 : 0);
+    }
+    return to_key_list(keys);
+}
+
+// Recovers the miner key and the keys of all the transaction signatures of a block,
+// recoverable only tells that every signature yields a key. Checking the keys against
+// the miner and the required authorities is left to the caller. The transactions of a
+// block cannot be changed in place, so their digests are cached by the block.
+bp::dict verify_all(const bp::object& obj, const graphene::chain::chain_id_type& chain_id, unsigned threads)
+{
+    const graphene::chain::signed_block& block = bp::extract<const graphene::chain::signed_block&>(obj);
+    std::size_t count = block.transactions.size();
+    bp::dict cache = digest_cache(obj);
+    std::string key = signature_digest_key(chain_id);
+    bool cached = cache.has_key(key);
+    std::vector<graphene::chain::digest_type> digests(count);
+    if(cached)
+        digests = vector_from_list<graphene::chain::digest_type>(bp::extract<bp::list>(cache[key]));
+
+    std::vector<std::vector<fc::optional<graphene::chain::public_key_type>>> keys(count);
+    fc::optional<graphene::chain::public_key_type> signee;
+    {
+        gil_release nogil;
+        parallel_for(count + 1, threads, [&](std::size_t i) {
+            if(i == count) {
+                signee = recover_key(block.miner_signature, block.digest());
+                return;
+            }
+            if(!cached)
+                digests[i] = block.transactions[i].sig_digest(chain_id);
+            keys[i] = recover_keys(block.transactions[i], digests[i], 1);
+        });
+    }
+
+    if(!cached) {
+        bp::list l;
+        for(const auto& digest : digests)
+            l.append(digest);
+        cache[key] = l;
+    }
+
+    bool recoverable = signee.valid();
+    bp::list transactions;
+    for(const auto& trx_keys : keys) {
+        for(const auto& key : trx_keys)
+            recoverable = recoverable && key.valid();
+        transactions.append(to_key_list(trx_keys));
+    }
+
+    bp::dict result;
+    result["signee"] = encode_optional_value(signee);
+    result["transactions"] = transactions;
+    result["recoverable"] = recoverable;
+    return result;
+}
+
+// a list of keys signs every transaction, a list of lists signs each transaction with its own keys
+bp::list sign_transactions(const bp::list& trxs, const bp::list& keys, const graphene::chain::chain_id_type& chain_id, unsigned threads)
+{
+    std::vector<graphene::chain::signed_transaction> signed_trxs = vector_from_list<graphene::chain::signed_transaction>(trxs);
+    std::vector<std::vector<graphene::chain::private_key_type>> trx_keys;
+    if(bp::len(keys) > 0 && bp::extract<bp::list>(keys[0]).check()) {
+        if(bp::len(keys) != bp::len(trxs))
+            throw std::invalid_argument("one list of keys per transaction expected");
+        for(bp::ssize_t i = 0; i < bp::len(keys); ++i)
+            trx_keys.push_back(vector_from_list<graphene::chain::private_key_type>(bp::extract<bp::list>(keys[i])));
+    }
+    else {
+        trx_keys.push_back(vector_from_list<graphene::chain::private_key_type>(keys));
+    }
+
+    // the digests cached by the transactions are reused, the missing ones are computed in
+    // parallel and cached afterwards; signed copies start with the same cache
+    std::string digest_key = signature_digest_key(chain_id);
+    std::vector<graphene::chain::digest_type> digests(signed_trxs.size());
+    std::vector<bool> cached(signed_trxs.size());
+    for(std::size_t i = 0; i < signed_trxs.size(); ++i) {
+        bp::dict cache = digest_cache(trxs[i]);
+        cached[i] = cache.has_key(digest_key);
+        if(cached[i])
+            digests[i] = bp::extract<graphene::chain::digest_type>(cache[digest_key]);
+    }
+
+    {
+        gil_release nogil;
+        parallel_for(signed_trxs.size(), threads, [&](std::size_t i) {
+            graphene::chain::signed_transaction& trx = signed_trxs[i];
+            if(!cached[i])
+                digests[i] = trx.sig_digest(chain_id);
+            for(const auto& key : trx_keys[trx_keys.size() == 1 ? 0 : i])
+                trx.signatures.push_back(key.sign_compact(digests[i]));
+        });
+    }
+
+    bp::list l;
+    for(std::size_t i = 0; i < signed_trxs.size(); ++i) {
+        if(!cached[i])
+            digest_cache(trxs[i])[digest_key] = digests[i];
+        bp::object trx(signed_trxs[i]);
+        digest_cache(trx)[digest_key] = digests[i];
+        l.append(trx);
+    }
+    return l;
+}
+
+template<typename T>
+void read_column(const Py_buffer& view, std::vector<int64_t>& column)
+{
+    const T* data = static_cast<const T*>(view.buf);
+    const T* end = data + view.len / view.itemsize;
+    // unsigned 64 bit values past INT64_MAX would wrap around to negative ones
+    if(std::is_unsigned<T>::value && sizeof(T) == sizeof(int64_t)) {
+        const T* it = std::find_if(data, end, [](T value) { return static_cast<uint64_t>(value) > static_cast<uint64_t>(INT64_MAX); });
+        if(it != end)
+            throw std::invalid_argument("value " + std::to_string(static_cast<uint64_t>(*it)) + " at index " + std::to_string(it - data) + " does not fit in a signed 64 bit integer");
+    }
+    column.assign(data, end);
+}
+
+int64_t account_instance(const bp::object& obj)
+{
+    bp::extract<graphene::chain::account_id_type> id(obj);
+    return id.check() ? static_cast<graphene::db::object_id_type>(id()).instance() : bp::extract<int64_t>(obj)();
+}
+
+int64_t integer(const bp::object& obj)
+{
+    return bp::extract<int64_t>(obj);
+}
+
+// integers from a buffer such as a numpy array, or from a sequence converted item by item
+std::vector<int64_t> integer_column(const bp::object& obj, int64_t (*item)(const bp::object&))
+{
+    std::vector<int64_t> column;
+    Py_buffer view;
+    if(PyObject_CheckBuffer(obj.ptr()) && PyObject_GetBuffer(obj.ptr(), &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == 0) {
+        std::string format = view.format ? view.format : "B";
+        char kind = format.empty() ? 'B' : format.back();
+        bool is_signed = std::strchr("bhilqn", kind) != nullptr;
+        bool is_unsigned = std::strchr("BHILQN", kind) != nullptr;
+        try {
+            switch(is_signed || is_unsigned ? view.itemsize : 0) {
+                case 1: is_signed ? read_column<int8_t>(view, column) : read_column<uint8_t>(view, column); break;
+                case 2: is_signed ? read_column<int16_t>(view, column) : read_column<uint16_t>(view, column); break;
+                case 4: is_signed ? read_column<int32_t>(view, column) : read_column<uint32_t>(view, column); break;
+                case 8: is_signed ? read_column<int64_t>(view, column) : read_column<uint64_t>(view, column); break;
+                default:
+                    throw std::invalid_argument("buffer of integers expected, got format " + format);
+            }
+        }
+        catch(...) {
+            PyBuffer_Release(&view);
+            throw;
+        }
+        PyBuffer_Release(&view);
+        return column;
+    }
+
+    PyErr_Clear();
+    auto len = bp::len(obj);
+    column.resize(len);
+    while(len--)
+        column[len] = item(obj[len]);
+    return column;
+}
+
+// memos are None, a Memo or a plain text string
+fc::optional<graphene::chain::memo_data> memo_from_object(const bp::object& obj)
+{
+    if(obj.is_none())
+        return {};
+
+    bp::extract<std::string> text(obj);
+    if(text.check())
+        return graphene::chain::memo_data(text(), graphene::chain::private_key_type(), graphene::chain::public_key_type());
+
+    return bp::extract<graphene::chain::memo_data>(obj)();
+}
+
+// builds transfers of one asset from parallel columns of senders, receivers, amounts and optional memos
+std::vector<graphene::chain::operation> make_transfers(const bp::object& senders, const bp::object& receivers, const bp::object& amounts,
+                                                       const graphene::chain::asset_id_type& asset_id, const bp::object& memos,
+                                                       const graphene::chain::asset& fee)
+{
+    std::vector<int64_t> from = integer_column(senders, account_instance);
+    std::vector<int64_t> to = integer_column(receivers, account_instance);
+    std::vector<int64_t> amount = integer_column(amounts, integer);
+    if(from.size() != to.size() || from.size() != amount.size() || (!memos.is_none() && bp::len(memos) != static_cast<bp::ssize_t>(from.size())))
+        throw std::invalid_argument("columns of equal length expected");
+
+    std::vector<graphene::chain::operation> ops;
+    ops.reserve(from.size());
+    graphene::chain::transfer_operation op;
+    op.fee = fee;
+    for(std::size_t i = 0; i < from.size(); ++i) {
+        op.from = graphene::chain::account_id_type(from[i]);
+        op.to = graphene::chain::account_id_type(to[i]);
+        op.amount = graphene::chain::asset(amount[i], asset_id);
+        if(!memos.is_none())
+            op.memo = memo_from_object(memos[i]);
+        ops.emplace_back(op);
+    }
+    return ops;
+}
+
+bp::list build_transfers(const bp::object& senders, const bp::object& receivers, const bp::object& amounts,
+                         const graphene::chain::asset_id_type& asset_id, const bp::object& memos, const graphene::chain::asset& fee)
+{
+    bp::list l;
+    for(const auto& op : make_transfers(senders, receivers, amounts, asset_id, memos, fee))
+        l.append(op);
+    return l;
+}
+
+std::size_t add_transfers(const bp::object& trx, const bp::object& senders, const bp::object& receivers, const bp::object& amounts,
+                          const graphene::chain::asset_id_type& asset_id, const bp::object& memos, const graphene::chain::asset& fee)
+{
+    std::vector<graphene::chain::operation> ops = make_transfers(senders, receivers, amounts, asset_id, memos, fee);
+    std::vector<graphene::chain::operation>& trx_ops = bp::extract<graphene::chain::transaction&>(trx)().operations;
+    trx_ops.insert(trx_ops.end(), ops.begin(), ops.end());
+    invalidate_digests(trx);
+    return ops.size();
+}
+
+// Splits the operations in order into the fewest signed transactions whose packed size with
+// the given number of signatures stays within max_size, summing the sizes of the operations.
+bp::list pack_operations(const bp::list& ops, std::size_t max_size, uint32_t signatures)
+{
+    graphene::chain::signed_transaction trx;
+    trx.signatures.resize(signatures);
+    const std::size_t empty_size = fc::raw::pack_size(trx) - fc::raw::pack_size(fc::unsigned_int(0));
+
+    bp::list trxs;
+    std::size_t size = empty_size;
+    for(bp::ssize_t i = 0; i < bp::len(ops); ++i) {
+        const graphene::chain::operation& op = bp::extract<const graphene::chain::operation&>(ops[i]);
+        std::size_t op_size = fc::raw::pack_size(op);
+        auto fits = [&]() { return size + op_size + fc::raw::pack_size(fc::unsigned_int(trx.operations.size() + 1)) <= max_size; };
+        if(!fits() && !trx.operations.empty()) {
+            trx.signatures.clear();
+            trxs.append(trx);
+            trx.operations.clear();
+            trx.signatures.resize(signatures);
+            size = empty_size;
+        }
+        if(!fits())
+            throw std::invalid_argument("operation " + std::to_string(i) + " does not fit in a transaction of " + std::to_string(max_size) + " bytes");
+
+        trx.operations.push_back(op);
+        size += op_size;
+    }
+
+    if(!trx.operations.empty()) {
+        trx.signatures.clear();
+        trxs.append(trx);
+    }
+    return trxs;
+}
+
+// Validates operations and transactions on native threads, the result holds None for a
+// valid item and the exception otherwise. The items are copied first, Python code may
+// change or drop them while the GIL is released.
+bp::list validate_all(const bp::list& items, unsigned threads)
+{
+    auto count = bp::len(items);
+    std::vector<graphene::chain::operation> ops(count);
+    std::vector<graphene::chain::transaction> trxs(count);
+    std::vector<bool> is_op(count);
+    for(bp::ssize_t i = 0; i < count; ++i) {
+        bp::extract<const graphene::chain::operation&> op(items[i]);
+        is_op[i] = op.check();
+        if(is_op[i])
+            ops[i] = op();
+        else
+            trxs[i] = bp::extract<const graphene::chain::transaction&>(items[i])();
+    }
+
+    std::vector<std::string> errors(count);
+    {
+        gil_release nogil;
+        parallel_for(count, threads, [&](std::size_t i) {
+            try {
+                if(is_op[i])
+                    graphene::chain::operation_validate(ops[i]);
+                else
+                    trxs[i].validate();
+            }
+            catch(const fc::exception& e) {
+                errors[i] = e.to_detail_string();
+            }
+            catch(const std::exception& e) {
+                errors[i] = e.what();
+            }
+        });
+    }
+
+    bp::list result;
+    bp::object exception(bp::handle<>(bp::borrowed(exception_class)));
+    for(const auto& e : errors)
+        result.append(e.empty() ? bp::object() : exception(e));
+    return result;
+}
+
+// LRU of ECDH shared secrets keyed by the public keys of both sides. Deriving a secret is an
+// elliptic curve multiplication, the encryption itself only a hash and an AES pass.
+class shared_secret_cache
+{
+public:
+    explicit shared_secret_cache(std::size_t capacity) : m_capacity(capacity) {}
+
+    // from is the public key of priv, the caller derives it once for a batch
+    fc::sha512 get(const graphene::chain::private_key_type& priv, const graphene::chain::public_key_type& from, const graphene::chain::public_key_type& to)
+    {
+        std::string key(reinterpret_cast<const char*>(from.key_data.begin()), from.key_data.size());
+        key.append(reinterpret_cast<const char*>(to.key_data.begin()), to.key_data.size());
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_index.find(key);
+            if(it != m_index.end()) {
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                ++m_hits;
+                return it->second->second;
+            }
+        }
+
+        fc::sha512 secret = priv.get_shared_secret(to);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_misses;
+        if(m_index.count(key) == 0) {
+            m_entries.emplace_front(key, secret);
+            m_index[key] = m_entries.begin();
+            evict();
+        }
+        return secret;
+    }
+
+    // a capacity of 0 disables the cache
+    void set_capacity(std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity = capacity;
+        evict();
+    }
+
+    // drops the secrets, e.g. once the sender key is retired, and resets the counters
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_index.clear();
+        m_hits = m_misses = 0;
+    }
+
+    bp::dict stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bp::dict d;
+        d["hits"] = m_hits;
+        d["misses"] = m_misses;
+        d["size"] = m_entries.size();
+        d["capacity"] = m_capacity;
+        return d;
+    }
+
+private:
+    typedef std::list<std::pair<std::string, fc::sha512>> entries;
+
+    void evict()
+    {
+        while(m_entries.size() > m_capacity) {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+    }
+
+    std::size_t m_capacity;
+    mutable std::mutex m_mutex;
+    entries m_entries;
+    std::unordered_map<std::string, entries::iterator> m_index;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+shared_secret_cache shared_secrets(4096);
+
+// the AES key of a memo, as memo_data derives it from the shared secret
+fc::sha512 memo_cipher_key(const fc::sha512& secret, uint64_t nonce)
+{
+    return fc::sha512::hash(fc::to_string(nonce) + secret.str());
+}
+
+// same as memo_data::encrypt_message with the shared secret already derived
+graphene::chain::memo_data::message_type encrypt_memo_message(const std::string& message, const fc::sha512& secret, uint64_t nonce)
+{
+    std::string text = graphene::chain::memo_message(graphene::chain::digest_type::hash(message)._hash[0], message).serialize();
+    return fc::aes_encrypt(memo_cipher_key(secret, nonce), graphene::chain::memo_data::message_type(text.begin(), text.end()));
+}
+
+// memo_data only encrypts with the keys, so the cached secret needs encrypt_memo_message. Its
+// output is compared with memo_data once, should they ever differ memo_data is used instead.
+std::vector<char> encrypt_memo(const std::string& message, const graphene::chain::private_key_type& priv,
+                               const graphene::chain::public_key_type& from, const graphene::chain::public_key_type& to, uint64_t nonce)
+{
+    static std::once_flag checked;
+    static bool same_layout = false;
+    std::call_once(checked, [&]() {
+        same_layout = encrypt_memo_message(message, shared_secrets.get(priv, from, to), nonce) == graphene::chain::memo_data::encrypt_message(message, priv, to, nonce);
+    });
+
+    if(!same_layout)
+        return graphene::chain::memo_data::encrypt_message(message, priv, to, nonce);
+    return encrypt_memo_message(message, shared_secrets.get(priv, from, to), nonce);
+}
+
+// encrypts each message for the receiver at the same position
+bp::list encrypt_many(const bp::list& messages, const graphene::chain::private_key_type& sender_key, const bp::list& receiver_keys, unsigned threads)
+{
+    std::vector<std::string> texts = vector_from_list<std::string>(messages);
+    std::vector<graphene::chain::public_key_type> receivers = vector_from_list<graphene::chain::public_key_type>(receiver_keys);
+    if(texts.size() != receivers.size())
+        throw std::invalid_argument("one receiver key per message expected");
+
+    std::vector<graphene::chain::memo_data> memos(texts.size());
+    {
+        gil_release nogil;
+        graphene::chain::public_key_type sender = sender_key.get_public_key();
+        for(auto& memo : memos)
+            memo.nonce = graphene::chain::memo_data::generate_nonce();
+
+        parallel_for(memos.size(), threads, [&](std::size_t i) {
+            graphene::chain::memo_data& memo = memos[i];
+            memo.from = sender;
+            memo.to = receivers[i];
+            memo.message = encrypt_memo(texts[i], sender_key, sender, receivers[i], memo.nonce);
+        });
+    }
+
+    bp::list l;
+    for(const auto& memo : memos)
+        l.append(memo);
+    return l;
+}
+
+// same as memo_data::decrypt_message with the shared secret already derived
+std::string decrypt_memo_message(const graphene::chain::memo_data::message_type& message, const fc::sha512& secret, uint64_t nonce)
+{
+    graphene::chain::memo_data::message_type plain = fc::aes_decrypt(memo_cipher_key(secret, nonce), message);
+    graphene::chain::memo_message result = graphene::chain::memo_message::deserialize(std::string(plain.begin(), plain.end()));
+    FC_ASSERT(result.checksum == static_cast<uint32_t>(graphene::chain::digest_type::hash(result.text)._hash[0]));
+    return result.text;
+}
+
+typedef std::map<graphene::chain::public_key_type, graphene::chain::private_key_type> private_key_map;
+
+// decrypts with the key of either side, a message without a sender key is plain text
+fc::optional<std::string> decrypt_with_keys(const graphene::chain::memo_data::message_type& message, uint64_t nonce,
+                                            const graphene::chain::public_key_type& from, const graphene::chain::public_key_type& to,
+                                            const private_key_map& keys)
+{
+    try {
+        if(from == graphene::chain::public_key_type())
+            return graphene::chain::memo_message::deserialize(std::string(message.begin(), message.end())).text;
+
+        const graphene::chain::public_key_type* other = &from;
+        auto it = keys.find(to);
+        if(it == keys.end()) {
+            it = keys.find(from);
+            other = &to;
+        }
+        if(it == keys.end())
+            return {};
+
+        return decrypt_memo_message(message, shared_secrets.get(it->second, it->first, *other), nonce);
+    }
+    catch(const fc::exception&) {
+        return {};
+    }
+}
+
+// copies of the memo or payload, they are decrypted without the GIL
+struct memo_source
+{
+    fc::optional<graphene::chain::memo_data> memo;
+    fc::optional<graphene::chain::message_payload> payload;
+};
+
+// finds the memo or messaging payload carried by an operation
+struct memo_source_visitor
+{
+    typedef void result_type;
+
+    memo_source& source;
+
+    template<typename T>
+    void operator()(const T&) const {}
+
+    void operator()(const graphene::chain::transfer_operation& op) const { set(op.memo); }
+    void operator()(const graphene::chain::asset_issue_operation& op) const { set(op.memo); }
+    void operator()(const graphene::chain::withdraw_permission_claim_operation& op) const { set(op.memo); }
+    void operator()(const graphene::chain::non_fungible_token_issue_operation& op) const { set(op.memo); }
+    void operator()(const graphene::chain::non_fungible_token_transfer_operation& op) const { set(op.memo); }
+
+    void operator()(const graphene::chain::custom_operation& op) const
+    {
+        if(op.id == graphene::chain::custom_operation::custom_operation_subtype_messaging) {
+            graphene::chain::message_payload payload;
+            op.get_messaging_payload(payload);
+            source.payload = payload;
+        }
+    }
+
+    void set(const fc::optional<graphene::chain::memo_data>& memo) const
+    {
+        if(memo.valid())
+            source.memo = *memo;
+    }
+};
+
+fc::optional<std::string> decrypt_source(const memo_source& source, const private_key_map& keys)
+{
+    if(source.memo)
+        return decrypt_with_keys(source.memo->message, source.memo->nonce, source.memo->from, source.memo->to, keys);
+
+    if(source.payload) {
+        const graphene::chain::message_payload& pl = *source.payload;
+        for(const auto& rd : pl.receivers_data) {
+            if(keys.count(rd.pub_to))
+                return decrypt_with_keys(rd.data, rd.nonce, pl.pub_from, rd.pub_to, keys);
+        }
+        if(!pl.receivers_data.empty())
+            return decrypt_with_keys(pl.receivers_data.front().data, pl.receivers_data.front().nonce, pl.pub_from, pl.receivers_data.front().pub_to, keys);
+    }
+
+    return {};
+}
+
+// Decrypts memos, messaging payloads and the memos of operations with whichever of the keys
+// belongs to the sender or a receiver, the result holds bytes or None when none matches.
+bp::list decrypt_memos(const bp::list& items, const bp::list& private_keys, unsigned threads)
+{
+    auto count = bp::len(items);
+    std::vector<memo_source> sources(count);
+    for(bp::ssize_t i = 0; i < count; ++i) {
+        bp::extract<const graphene::chain::memo_data&> memo(items[i]);
+        bp::extract<const graphene::chain::message_payload&> payload(items[i]);
+        if(memo.check())
+            sources[i].memo = memo();
+        else if(payload.check())
+            sources[i].payload = payload();
+        else
+            bp::extract<const graphene::chain::operation&>(items[i])().visit(memo_source_visitor{ sources[i] });
+    }
+
+    std::vector<graphene::chain::private_key_type> key_list = vector_from_list<graphene::chain::private_key_type>(private_keys);
+    std::vector<fc::optional<std::string>> texts(count);
+    {
+        gil_release nogil;
+        private_key_map keys;
+        for(const auto& key : key_list)
+            keys.emplace(key.get_public_key(), key);
+
+        parallel_for(count, threads, [&](std::size_t i) { texts[i] = decrypt_source(sources[i], keys); });
+    }
+
+    bp::list l;
+    for(const auto& text : texts)
+        l.append(text.valid() ? bp::object(bp::handle<>(PyBytes_FromStringAndSize(text->data(), text->size()))) : bp::object());
+    return l;
+}
+
+bp::dict shared_secret_stats()
+{
+    return shared_secrets.stats();
+}
+
+void set_shared_secret_capacity(std::size_t capacity)
+{
+    shared_secrets.set_capacity(capacity);
+}
+
+void clear_shared_secrets()
+{
+    shared_secrets.clear();
 }
 
 graphene::chain::memo_data::message_type get_message(const graphene::chain::memo_data& memo)
@@ -165,6 +901,11 @@ void register_common_types()
     bp::scope().attr("Exception") = bp::handle<>(bp::borrowed(exception_class));
     bp::register_exception_translator<fc::exception>(exception_translator);
 
+    bp::tuple timeout_bases = bp::make_tuple(bp::handle<>(bp::borrowed(exception_class)), bp::handle<>(bp::borrowed(PyExc_TimeoutError)));
+    scopeName = bp::extract<std::string>(bp::scope().attr("__name__"))() + ".Timeout";
+    timeout_class = PyErr_NewException(scopeName.c_str(), timeout_bases.ptr(), nullptr);
+    bp::scope().attr("Timeout") = bp::handle<>(bp::borrowed(timeout_class));
+
     bp::to_python_converter<fc::variant, variant_converter>();
     bp::converter::registry::push_back(variant_converter::convertible, variant_converter::construct, bp::type_id<fc::variant>());
 
@@ -174,7 +915,7 @@ void register_common_types()
     register_hash<fc::ripemd160>("RIPEMD160");
     register_hash<fc::sha256>("SHA256");
 
-    bp::class_<fc::uint128>("UInt128", bp::init<>())
+    def_bytes(bp::class_<fc::uint128>("UInt128", bp::init<>()))
         .def(bp::init<uint64_t>())
         .def(bp::init<const std::string&>())
         .def("__repr__", object_repr<fc::uint128>)
@@ -189,12 +930,12 @@ void register_common_types()
         .def("sec_since_epoch", &fc::time_point_sec::sec_since_epoch)
     ;
 
-    bp::class_<fc::ecc::compact_signature>("CompactSignature", bp::no_init)
+    def_bytes(bp::class_<fc::ecc::compact_signature>("CompactSignature", bp::no_init))
         .def("__repr__", object_repr<fc::ecc::compact_signature>)
         .def("__len__", &fc::ecc::compact_signature::size)
     ;
 
-    bp::class_<graphene::chain::public_key_type>("PublicKey", bp::init<bp::optional<std::string>>())
+    def_bytes(bp::class_<graphene::chain::public_key_type>("PublicKey", bp::init<bp::optional<std::string>>()))
         .def("__repr__", object_repr<graphene::chain::public_key_type>)
         .def("__str__", &graphene::chain::public_key_type::operator std::string)
     ;
@@ -217,6 +958,12 @@ void register_common_types()
     ;
 
     bp::def("generate_brain_key", &graphene::utilities::generate_brain_key);
+    bp::def("sign_transactions", sign_transactions, (bp::arg("trxs"), bp::arg("keys"), bp::arg("chain_id"), bp::arg("threads") = 0));
+    bp::def("build_transfers", build_transfers, (bp::arg("senders"), bp::arg("receivers"), bp::arg("amounts"), bp::arg("asset_id"),
+                                                 bp::arg("memos") = bp::object(), bp::arg("fee") = graphene::chain::asset()));
+    bp::def("decrypt_memos", decrypt_memos, (bp::arg("items"), bp::arg("private_keys"), bp::arg("threads") = 0));
+    bp::def("validate_all", validate_all, (bp::arg("items"), bp::arg("threads") = 0));
+    bp::def("pack_operations", pack_operations, (bp::arg("ops"), bp::arg("max_size"), bp::arg("signatures") = 1));
     bp::def("derive_private_key", &graphene::utilities::derive_private_key, (bp::arg("brainkey"), bp::arg("sequence") = 0));
 
     bp::class_<decent::encrypt::DIntegerString>("ElGamalKey", bp::no_init)
@@ -227,7 +974,7 @@ void register_common_types()
         .staticmethod("generate")
     ;
 
-    bp::class_<graphene::db::object_id_type>("ObjectId", bp::init<uint8_t, uint8_t, uint8_t>())
+    def_bytes(bp::class_<graphene::db::object_id_type>("ObjectId", bp::init<uint8_t, uint8_t, uint8_t>()))
         .def(bp::init<std::string>())
         .def("__repr__", object_repr<graphene::db::object_id_type>)
         .def("__str__", &graphene::db::object_id_type::operator std::string)
@@ -268,7 +1015,7 @@ void register_common_types()
     register_object_id<graphene::chain::message_id_type>("MessageId");
     register_object_id<graphene::chain::transaction_history_id_type>("TransactionHistoryId");
 
-    bp::class_<graphene::chain::memo_data>("Memo", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::memo_data>("Memo", bp::init<>()))
         .def(bp::init<const std::string&, const graphene::chain::private_key_type&, const graphene::chain::public_key_type&, bp::optional<uint64_t>>())
         .def("__repr__", object_repr<graphene::chain::memo_data>)
         .def_readwrite("sender", &graphene::chain::memo_data::from)
@@ -282,32 +1029,49 @@ void register_common_types()
         .staticmethod("decrypt_message")
         .def("generate_nonce", graphene::chain::memo_data::generate_nonce)
         .staticmethod("generate_nonce")
+        .def("encrypt_many", encrypt_many, (bp::arg("messages"), bp::arg("sender_key"), bp::arg("receiver_keys"), bp::arg("threads") = 0))
+        .staticmethod("encrypt_many")
+        .def("shared_secret_stats", shared_secret_stats)
+        .staticmethod("shared_secret_stats")
+        .def("set_shared_secret_capacity", set_shared_secret_capacity, (bp::arg("capacity")))
+        .staticmethod("set_shared_secret_capacity")
+        .def("clear_shared_secrets", clear_shared_secrets)
+        .staticmethod("clear_shared_secrets")
     ;
 
-    bp::class_<graphene::chain::transaction>("Transaction", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::transaction>("Transaction", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::transaction>)
         .def("validate", &graphene::chain::transaction::validate)
-        .def("digest", &graphene::chain::transaction::digest)
-        .def("signature_digest", &graphene::chain::transaction::sig_digest)
-        .def("set_reference_block", &graphene::chain::transaction::set_reference_block)
-        .def_readwrite("ref_block_num", &graphene::chain::transaction::ref_block_num)
-        .def_readwrite("ref_block_prefix", &graphene::chain::transaction::ref_block_prefix)
-        .def_readwrite("expiration", &graphene::chain::transaction::expiration)
-        .add_property("id", &graphene::chain::transaction::id)
+        .def("digest", transaction_digest)
+        .def("signature_digest", transaction_signature_digest)
+        .def("packed_size", object_packed_size<graphene::chain::transaction>)
+        .def("set_reference_block", set_reference_block)
+        .def("add_transfers", add_transfers, (bp::arg("senders"), bp::arg("receivers"), bp::arg("amounts"), bp::arg("asset_id"),
+                                              bp::arg("memos") = bp::object(), bp::arg("fee") = graphene::chain::asset()))
+        .add_property("ref_block_num", bp::make_getter(&graphene::chain::transaction::ref_block_num),
+            set_transaction_member<uint16_t, &graphene::chain::transaction::ref_block_num>)
+        .add_property("ref_block_prefix", bp::make_getter(&graphene::chain::transaction::ref_block_prefix),
+            set_transaction_member<uint32_t, &graphene::chain::transaction::ref_block_prefix>)
+        .add_property("expiration", bp::make_getter(&graphene::chain::transaction::expiration),
+            set_transaction_member<fc::time_point_sec, &graphene::chain::transaction::expiration>)
+        .add_property("id", transaction_id)
         .add_property("operations",
             encode_list<graphene::chain::transaction, std::vector<graphene::chain::operation>, &graphene::chain::transaction::operations>,
-            decode_list<graphene::chain::transaction, std::vector<graphene::chain::operation>, &graphene::chain::transaction::operations>)
+            set_operations)
     ;
 
-    bp::class_<graphene::chain::signed_transaction, bp::bases<graphene::chain::transaction>>("SignedTransaction", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::signed_transaction, bp::bases<graphene::chain::transaction>>("SignedTransaction", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::signed_transaction>)
+        .def("packed_size", object_packed_size<graphene::chain::signed_transaction>)
         .def("sign", sign_transaction)
+        .def("sign_many", sign_many, (bp::arg("keys"), bp::arg("chain_id")))
+        .def("get_signature_keys", get_signature_keys, (bp::arg("chain_id")))
         .add_property("signatures",
             encode_list<graphene::chain::signed_transaction, std::vector<graphene::chain::signature_type>, &graphene::chain::signed_transaction::signatures>,
             decode_list<graphene::chain::signed_transaction, std::vector<graphene::chain::signature_type>, &graphene::chain::signed_transaction::signatures>)
     ;
 
-    bp::class_<graphene::chain::processed_transaction, bp::bases<graphene::chain::signed_transaction>>("ProcessedTransaction", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::processed_transaction, bp::bases<graphene::chain::signed_transaction>>("ProcessedTransaction", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::processed_transaction>)
         .def("merkle_digest", &graphene::chain::processed_transaction::merkle_digest)
         .add_property("operation_results",
@@ -315,7 +1079,7 @@ void register_common_types()
             decode_list<graphene::chain::processed_transaction, std::vector<graphene::chain::operation_result>, &graphene::chain::processed_transaction::operation_results>)
     ;
 
-    bp::class_<graphene::chain::block_header>("BlockHeader", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::block_header>("BlockHeader", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::block_header>)
         .def("digest", &graphene::chain::block_header::digest)
         .def("block_num", &graphene::chain::block_header::block_num)
@@ -327,7 +1091,7 @@ void register_common_types()
         .def_readwrite("transaction_merkle_root", &graphene::chain::block_header::transaction_merkle_root)
     ;
 
-    bp::class_<graphene::chain::signed_block_header, bp::bases<graphene::chain::block_header>>("SignedBlockHeader", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::signed_block_header, bp::bases<graphene::chain::block_header>>("SignedBlockHeader", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::signed_block_header>)
         .def("id", &graphene::chain::signed_block_header::id)
         .def("signee", &graphene::chain::signed_block_header::signee)
@@ -336,13 +1100,14 @@ void register_common_types()
         .def_readwrite("miner_signature", &graphene::chain::signed_block_header::miner_signature)
     ;
 
-    bp::class_<graphene::chain::signed_block, bp::bases<graphene::chain::signed_block_header>>("SignedBlock", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::signed_block, bp::bases<graphene::chain::signed_block_header>>("SignedBlock", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::signed_block>)
         .def("calculate_merkle_root", &graphene::chain::signed_block::calculate_merkle_root)
+        .def("verify_all", verify_all, (bp::arg("chain_id"), bp::arg("threads") = 0))
         .add_property("transactions", encode_list<graphene::chain::signed_block, std::vector<graphene::chain::processed_transaction>, &graphene::chain::signed_block::transactions>)
     ;
 
-    bp::class_<graphene::chain::signed_block_with_info, bp::bases<graphene::chain::signed_block>>("SignedBlockInfo", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::signed_block_with_info, bp::bases<graphene::chain::signed_block>>("SignedBlockInfo", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::signed_block_with_info>)
         .add_property("transaction_ids", encode_list<graphene::chain::signed_block_with_info,
                                                      std::vector<graphene::chain::transaction_id_type>,
@@ -350,14 +1115,14 @@ void register_common_types()
         .add_property("miner_reward", decode_safe_type<graphene::chain::signed_block_with_info, int64_t, &graphene::chain::signed_block_with_info::miner_reward>)
     ;
 
-    bp::class_<graphene::chain::asset>("Balance", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset>("Balance", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset>)
         .add_property("amount", decode_safe_type<graphene::chain::asset, int64_t, &graphene::chain::asset::amount>,
                                 encode_safe_type<graphene::chain::asset, int64_t, &graphene::chain::asset::amount>)
         .def_readwrite("asset_id", &graphene::chain::asset::asset_id)
     ;
 
-    bp::class_<graphene::chain::price>("Price", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::price>("Price", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::price>)
         .def_readwrite("base", &graphene::chain::price::base)
         .def_readwrite("quote", &graphene::chain::price::quote)
@@ -365,7 +1130,7 @@ void register_common_types()
         .staticmethod("unit_price")
     ;
 
-    bp::class_<graphene::chain::real_supply>("RealSupply", bp::no_init)
+    def_bytes(bp::class_<graphene::chain::real_supply>("RealSupply", bp::no_init))
         .def("__repr__", object_repr<graphene::chain::real_supply>)
         .def("total", safe_value<graphene::chain::real_supply, int64_t, &graphene::chain::real_supply::total>)
         .add_property("account_balances", decode_safe_type<graphene::chain::real_supply, int64_t, &graphene::chain::real_supply::account_balances>)
@@ -374,7 +1139,7 @@ void register_common_types()
         .add_property("pools", decode_safe_type<graphene::chain::real_supply, int64_t, &graphene::chain::real_supply::pools>)
     ;
 
-    bp::class_<graphene::chain::database::votes_gained>("VotesGained", bp::no_init)
+    def_bytes(bp::class_<graphene::chain::database::votes_gained>("VotesGained", bp::no_init))
         .def("__repr__", object_repr<graphene::chain::database::votes_gained>)
         .def_readonly("account", &graphene::chain::database::votes_gained::account_name)
         .def_readonly("votes", &graphene::chain::database::votes_gained::votes)
@@ -5,14 +5,14 @@ namespace dcore {
 
 void register_miner()
 {
-    bp::class_<graphene::chain::vote_id_type>("VoteId", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::vote_id_type>("VoteId", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::vote_id_type>)
         .def("__str__", &graphene::chain::vote_id_type::operator std::string)
         .def(bp::init<const std::string&>())
         .add_property("instance", &graphene::chain::vote_id_type::instance, &graphene::chain::vote_id_type::set_instance)
     ;
 
-    bp::class_<graphene::app::miner_voting_info>("VotingInfo", bp::init<>())
+    def_bytes(bp::class_<graphene::app::miner_voting_info>("VotingInfo", bp::init<>()))
         .def("__repr__", object_repr<graphene::app::miner_voting_info>)
         .def_readwrite("id", &graphene::app::miner_voting_info::id)
         .def_readwrite("name", &graphene::app::miner_voting_info::name)
@@ -25,7 +25,7 @@ void register_miner()
     bp::class_<object_wrapper<graphene::chain::miner_object>, std::shared_ptr<graphene::chain::miner_object>> miner("Miner", bp::no_init);
     {
         bp::scope s = miner;
-        bp::class_<votes_gained>("VotesGained", bp::init<>())
+        def_bytes(bp::class_<votes_gained>("VotesGained", bp::init<>()))
             .def("__repr__", object_repr<votes_gained>)
             .def_readwrite("account", &votes_gained::first)
             .def_readwrite("votes", &votes_gained::second)
@@ -51,7 +51,7 @@ void register_miner()
     ;
 
     {
-        bp::scope policy = bp::class_<graphene::chain::vesting_policy>("VestingPolicy", bp::no_init)
+        bp::scope policy = def_bytes(bp::class_<graphene::chain::vesting_policy>("VestingPolicy", bp::no_init))
             .def(bp::init<const graphene::chain::linear_vesting_policy&>())
             .def(bp::init<const graphene::chain::cdd_vesting_policy&>())
             .def("__repr__", object_repr<graphene::chain::vesting_policy>)
@@ -59,7 +59,7 @@ void register_miner()
             .add_property("cdd", decode_static_variant<graphene::chain::vesting_policy, graphene::chain::cdd_vesting_policy>)
         ;
 
-        bp::class_<graphene::chain::linear_vesting_policy>("Linear", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::linear_vesting_policy>("Linear", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::linear_vesting_policy>)
             .def_readwrite("begin", &graphene::chain::linear_vesting_policy::begin_timestamp)
             .def_readwrite("vesting_cliff_seconds", &graphene::chain::linear_vesting_policy::vesting_cliff_seconds)
@@ -68,7 +68,7 @@ void register_miner()
                                      encode_safe_type<graphene::chain::linear_vesting_policy, int64_t, &graphene::chain::linear_vesting_policy::begin_balance>)
         ;
 
-        bp::class_<graphene::chain::cdd_vesting_policy>("Cdd", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::cdd_vesting_policy>("Cdd", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::cdd_vesting_policy>)
             .def_readwrite("vesting_seconds", &graphene::chain::cdd_vesting_policy::vesting_seconds)
             .def_readwrite("coin_seconds_earned", &graphene::chain::cdd_vesting_policy::coin_seconds_earned)
@@ -3,25 +3,28 @@
 #include <graphene/wallet/wallet.hpp>
 #include <graphene/utilities/dirhelper.hpp>
 #include <fc/log/logger_config.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/exception/exception.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 
 namespace wa = graphene::wallet;
 namespace ch = graphene::chain;
 
 namespace dcore {
 
-template<typename T>
-std::vector<T> vector_from_list(const bp::list &l)
-{
-    std::vector<T> obj;
-    auto len = bp::len(l);
-    obj.resize(len);
-    while(len--) {
-        bp::extract<T> v(l[len]);
-        obj[len] = v();
-    }
-    return obj;
-}
-
 template<typename T>
 std::set<T> set_from_list(const bp::list &l)
 {
@@ -73,149 +76,2273 @@ std::string decode_path(const T &obj)
     return fc::path_to_utf8((obj.*method)());
 }
 
-template<typename T, void (T::* method)(const boost::filesystem::path&)>
-void encode_path(T &obj, const std::string &p)
-{
-    (obj.*method)(fc::path_from_utf8(p));
-}
+template<typename T, void (T::* method)(const boost::filesystem::path&)>
+void encode_path(T &obj, const std::string &p)
+{
+    (obj.*method)(fc::path_from_utf8(p));
+}
+
+void configure_logging(const std::string &config)
+{
+    fc::configure_logging(fc::json::from_string(config).as<fc::logging_config>());
+}
+
+std::string default_logging()
+{
+    return fc::json::to_pretty_string(fc::logging_config::default_config());
+}
+
+struct as_object
+{
+    template<typename T>
+    bp::object operator()(const T& v) const { return bp::object(v); }
+};
+
+struct as_optional
+{
+    template<typename T>
+    bp::object operator()(const fc::optional<T>& v) const { return encode_optional_value(v); }
+};
+
+struct as_safe_value
+{
+    template<typename V>
+    bp::object operator()(const fc::safe<V>& v) const { return bp::object(to_safe_value(v)); }
+};
+
+struct as_list
+{
+    template<typename T>
+    bp::object operator()(const T& v) const { return to_list(v); }
+};
+
+struct as_optional_list
+{
+    template<typename T>
+    bp::object operator()(const T& v) const { return to_optional_list(v); }
+};
+
+struct as_dict
+{
+    template<typename T>
+    bp::object operator()(const T& v) const { return to_dict(v); }
+};
+
+void complete_future(const bp::object& future, const bp::object& result, const bp::object& error)
+{
+    if(future.attr("done")())
+        return;
+
+    if(error.is_none())
+        future.attr("set_result")(result);
+    else
+        future.attr("set_exception")(error);
+}
+
+// Resolves an asyncio future from the fc thread, the result is handed over
+// to the event loop through loop.call_soon_threadsafe.
+class async_completion
+{
+public:
+    static std::shared_ptr<async_completion> create()
+    {
+        // the last reference may be dropped by the fc thread
+        return std::shared_ptr<async_completion>(new async_completion(), [](async_completion* c) { gil_acquire gil; delete c; });
+    }
+
+    const bp::object& future() const { return m_future; }
+
+    template<typename Result>
+    void complete(const fc::exception_ptr& e, Result result)
+    {
+        gil_acquire gil;
+        bp::object value, error;
+        try {
+            if(e)
+                error = bp::object(bp::handle<>(bp::borrowed(exception_class)))(e->to_detail_string());
+            else
+                value = result();
+
+            static bp::object *complete_fn = new bp::object(bp::make_function(complete_future));
+            m_loop.attr("call_soon_threadsafe")(*complete_fn, m_future, value, error);
+        }
+        catch(const bp::error_already_set&) {
+            // the event loop is already closed
+            PyErr_Clear();
+        }
+    }
+
+private:
+    // the *_async calls are made from a coroutine, raises RuntimeError otherwise
+    async_completion() : m_loop(bp::import("asyncio").attr("get_running_loop")()), m_future(m_loop.attr("create_future")()) {}
+
+    bp::object m_loop;
+    bp::object m_future;
+};
+
+template<typename T>
+struct completion_handler
+{
+    template<typename Convert>
+    static auto make(const std::shared_ptr<async_completion> &c, Convert convert)
+    {
+        return [c, convert](const T& r, const fc::exception_ptr& e) { c->complete(e, [&]() { return bp::object(convert(r)); }); };
+    }
+};
+
+template<>
+struct completion_handler<void>
+{
+    template<typename Convert>
+    static auto make(const std::shared_ptr<async_completion> &c, Convert)
+    {
+        return [c](const fc::exception_ptr& e) { c->complete(e, []() { return bp::object(); }); };
+    }
+};
+
+// Calls the handler once with the outcome of the future. The request may complete before
+// the handler is attached, a future found ready afterwards is handled inline; the flag keeps
+// the handler from running twice when fc calls it as well.
+template<typename T, typename Handler>
+void when_complete(fc::future<T> f, Handler handler)
+{
+    auto called = std::make_shared<std::atomic<bool>>(false);
+    f.on_complete([called, handler](const T& r, const fc::exception_ptr& e) {
+        if(!called->exchange(true))
+            handler(r, e);
+    });
+    if(!f.ready() || called->exchange(true))
+        return;
+
+    T result;
+    fc::exception_ptr error;
+    try {
+        result = f.wait();
+    }
+    catch(const fc::exception &e) {
+        error = e.dynamic_copy_exception();
+    }
+    handler(result, error);
+}
+
+template<typename Handler>
+void when_complete(fc::future<void> f, Handler handler)
+{
+    auto called = std::make_shared<std::atomic<bool>>(false);
+    f.on_complete([called, handler](const fc::exception_ptr& e) {
+        if(!called->exchange(true))
+            handler(e);
+    });
+    if(!f.ready() || called->exchange(true))
+        return;
+
+    fc::exception_ptr error;
+    try {
+        f.wait();
+    }
+    catch(const fc::exception &e) {
+        error = e.dynamic_copy_exception();
+    }
+    handler(error);
+}
+
+// Returns a future completed after the hook has seen the outcome of the given one,
+// an fc future accepts a single completion handler only. The hook is called with the
+// exception and, unless the future is void, the result.
+template<typename T, typename Hook>
+fc::future<T> observe(fc::future<T> f, Hook hook)
+{
+    typename fc::promise<T>::ptr p(new fc::promise<T>("dcore::observe"));
+    when_complete(std::move(f), [p, hook](const T& r, const fc::exception_ptr& e) {
+        hook(e, r);
+        if(e)
+            p->set_exception(e);
+        else
+            p->set_value(r);
+    });
+    return fc::future<T>(p);
+}
+
+template<typename Hook>
+fc::future<void> observe(fc::future<void> f, Hook hook)
+{
+    fc::promise<void>::ptr p(new fc::promise<void>("dcore::observe"));
+    when_complete(std::move(f), [p, hook](const fc::exception_ptr& e) {
+        hook(e);
+        if(e)
+            p->set_exception(e);
+        else
+            p->set_value();
+    });
+    return fc::future<void>(p);
+}
+
+// Deadline of the Wallet calls made by the current thread, see Deadline.
+struct thread_deadline
+{
+    bool active = false;
+    std::chrono::steady_clock::time_point at;
+};
+
+inline thread_deadline& current_deadline()
+{
+    static thread_local thread_deadline deadline;
+    return deadline;
+}
+
+// Context manager bounding the time the Wallet calls made within it may take, nested
+// deadlines can only shorten the enclosing one.
+class Deadline
+{
+public:
+    explicit Deadline(double seconds)
+        : m_at(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds))) {}
+
+    void enter()
+    {
+        thread_deadline &current = current_deadline();
+        m_previous = current;
+        if(!current.active || m_at < current.at)
+            current = { true, m_at };
+    }
+
+    void exit(const bp::object&, const bp::object&, const bp::object&)
+    {
+        current_deadline() = m_previous;
+    }
+
+    double remaining() const
+    {
+        return std::max(std::chrono::duration<double>(m_at - std::chrono::steady_clock::now()).count(), 0.0);
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_at;
+    thread_deadline m_previous;
+};
+
+template<typename T>
+class pending
+{
+public:
+    explicit pending(fc::future<T> f, fc::time_point deadline = fc::time_point::maximum()) : m_future(std::move(f)), m_deadline(deadline) {}
+
+    // The future is cancelled once the deadline of the call passes, however long ago the
+    // call was made. Only the local result is dropped, the node still completes the request.
+    T wait()
+    {
+        try {
+            gil_release nogil;
+            return m_future.wait_until(m_deadline);
+        }
+        catch(const fc::timeout_exception&) {
+            if(m_future.ready())
+                throw;
+
+            m_future.cancel("timeout");
+            PyErr_SetString(timeout_class, "call timed out");
+            throw bp::error_already_set();
+        }
+    }
+
+    // for callers not holding the GIL, the earlier of the two deadlines applies
+    T wait_until(fc::time_point deadline = fc::time_point::maximum())
+    {
+        return m_future.wait_until(std::min(deadline, m_deadline));
+    }
+
+    // for callers not holding the GIL
+    fc::future<T> future() const { return m_future; }
+
+    template<typename Convert>
+    bp::object async(Convert convert)
+    {
+        auto c = async_completion::create();
+        when_complete(m_future, completion_handler<T>::make(c, convert));
+        return c->future();
+    }
+
+private:
+    fc::future<T> m_future;
+    fc::time_point m_deadline;
+};
+
+template<typename T>
+pending<T> make_pending(fc::future<T> f, fc::time_point deadline = fc::time_point::maximum())
+{
+    return pending<T>(std::move(f), deadline);
+}
+
+class Subscription;
+
+// Fans the block applied notifications of the connection out to the subscriptions.
+class block_subscribers
+{
+public:
+    void add(Subscription *s)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscriptions.push_back(s);
+    }
+
+    void remove(Subscription *s)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscriptions.erase(std::remove(m_subscriptions.begin(), m_subscriptions.end(), s), m_subscriptions.end());
+    }
+
+    void notify(const fc::variant &block_id);
+    uint32_t head() const { return m_head; }
+
+private:
+    std::mutex m_mutex;
+    std::vector<Subscription*> m_subscriptions;
+    std::atomic<uint32_t> m_head { 0 };
+};
+
+// Client side cache of chain objects, entries expire after the time to live or, unless
+// the objects are immutable, once a new head block has been applied.
+template<typename K, typename T>
+class object_cache
+{
+public:
+    void configure(double ttl, bool per_head)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_enabled = ttl > 0;
+        m_ttl = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::min(ttl, 1e9)));
+        m_per_head = per_head;
+        m_entries.clear();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    bool get(const K &key, uint32_t head, T &value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_enabled)
+            return false;
+
+        auto it = m_entries.find(key);
+        if(it == m_entries.end() || it->second.expires < std::chrono::steady_clock::now() || (m_per_head && it->second.head != head)) {
+            ++m_misses;
+            return false;
+        }
+
+        ++m_hits;
+        value = it->second.value;
+        return true;
+    }
+
+    void put(const K &key, uint32_t head, const T &value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_enabled)
+            m_entries[key] = { value, head, std::chrono::steady_clock::now() + m_ttl };
+    }
+
+    bp::dict stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bp::dict result;
+        result["hits"] = m_hits;
+        result["misses"] = m_misses;
+        result["size"] = m_entries.size();
+        return result;
+    }
+
+private:
+    struct entry
+    {
+        T value;
+        uint32_t head;
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<K, entry> m_entries;
+    std::chrono::steady_clock::duration m_ttl {};
+    bool m_enabled = false;
+    bool m_per_head = true;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+// Delivers block notifications to a Python callback on a dedicated thread. The queue
+// between the connection and the callback is bounded, the oldest notifications are
+// dropped once it is full or all but the latest one when coalescing.
+class Subscription
+{
+public:
+    enum kind { blocks, irreversible };
+
+    Subscription(wa::WalletAPI &api, const std::shared_ptr<block_subscribers> &subscribers, kind k, const bp::object &callback, uint32_t max_queue, bool coalesce)
+        : m_api(api), m_subscribers(subscribers), m_kind(k), m_callback(callback), m_max_queue(std::max(max_queue, 1u)), m_coalesce(coalesce)
+    {
+        m_thread = std::thread(&Subscription::run, this);
+        subscribers->add(this);
+    }
+
+    ~Subscription()
+    {
+        cancel();
+    }
+
+    // Deleter of the shared pointer. When the callback drops the last reference the object
+    // is still in use by its own thread, which then deletes it once the callback returns.
+    static void release(Subscription *s)
+    {
+        if(s->m_thread.get_id() == std::this_thread::get_id()) {
+            s->cancel();
+            s->m_release_on_exit = true;
+        }
+        else {
+            delete s;
+        }
+    }
+
+    void push(const ch::block_id_type &block_id)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_coalesce) {
+                m_dropped += m_queue.size();
+                m_queue.clear();
+            }
+            else if(m_queue.size() >= m_max_queue) {
+                m_queue.pop_front();
+                ++m_dropped;
+            }
+            m_queue.push_back(block_id);
+        }
+        m_cond.notify_one();
+    }
+
+    void cancel()
+    {
+        if(auto subscribers = m_subscribers.lock())
+            subscribers->remove(this);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cancelled = true;
+        }
+        m_cond.notify_all();
+
+        // cancelled from the callback itself, the thread finishes on its own
+        if(m_thread.joinable() && m_thread.get_id() != std::this_thread::get_id()) {
+            gil_release nogil;
+            m_thread.join();
+        }
+    }
+
+    bool active() const { return !m_cancelled; }
+    uint64_t dropped() const { std::lock_guard<std::mutex> lock(m_mutex); return m_dropped; }
+    uint64_t queued() const { std::lock_guard<std::mutex> lock(m_mutex); return m_queue.size(); }
+
+private:
+    void run()
+    {
+        process();
+        if(m_release_on_exit) {
+            m_thread.detach();
+            gil_acquire gil;
+            delete this;
+        }
+    }
+
+    void process()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(true) {
+            m_cond.wait(lock, [this]() { return m_cancelled || !m_queue.empty(); });
+            if(m_cancelled)
+                return;
+
+            ch::block_id_type block_id = m_queue.front();
+            m_queue.pop_front();
+            lock.unlock();
+            try {
+                dispatch(block_id);
+            }
+            catch(const fc::exception&) {
+                // the next notification retries the query
+            }
+            lock.lock();
+        }
+    }
+
+    void dispatch(const ch::block_id_type &block_id)
+    {
+        if(m_kind == blocks) {
+            gil_acquire gil;
+            call(ch::block_header::num_from_id(block_id), block_id);
+            return;
+        }
+
+        // this thread never holds the GIL, so the future is waited for directly; it gives up
+        // after query_timeout or on cancel, and the next notification retries the query
+        auto dgp = m_api.query(&wa::db_api::get_dynamic_global_properties);
+        fc::time_point deadline = fc::time_point::now() + query_timeout;
+        while(!dgp.ready()) {
+            if(m_cancelled || fc::time_point::now() >= deadline) {
+                dgp.cancel();
+                return;
+            }
+            try {
+                dgp.wait_until(std::min(deadline, fc::time_point::now() + poll_interval));
+            }
+            catch(const fc::timeout_exception&) {
+            }
+        }
+        uint32_t lib = dgp.wait().last_irreversible_block_num;
+        if(m_last_irreversible == 0 && lib > 0)
+            m_last_irreversible = lib - 1;
+
+        if(lib <= m_last_irreversible)
+            return;
+
+        gil_acquire gil;
+        while(m_last_irreversible < lib && !m_cancelled)
+            call(++m_last_irreversible);
+    }
+
+    template<typename... Args>
+    void call(const Args&... args)
+    {
+        try {
+            m_callback(args...);
+        }
+        catch(const bp::error_already_set&) {
+            PyErr_Print();
+        }
+    }
+
+    wa::WalletAPI &m_api;
+    std::weak_ptr<block_subscribers> m_subscribers;
+    kind m_kind;
+    bp::object m_callback;
+    uint32_t m_max_queue;
+    bool m_coalesce;
+    uint32_t m_last_irreversible = 0;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<ch::block_id_type> m_queue;
+    uint64_t m_dropped = 0;
+    std::atomic<bool> m_cancelled { false };
+    bool m_release_on_exit = false;
+    std::thread m_thread;
+
+    static const fc::microseconds query_timeout;
+    static const fc::microseconds poll_interval;
+};
+
+const fc::microseconds Subscription::query_timeout = fc::seconds(10);
+const fc::microseconds Subscription::poll_interval = fc::milliseconds(100);
+
+void block_subscribers::notify(const fc::variant &block_id)
+{
+    auto id = block_id.as<ch::block_id_type>();
+    m_head = ch::block_header::num_from_id(id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(Subscription *s : m_subscriptions)
+        s->push(id);
+}
+
+// Latency histogram with eight linear buckets per power of two microseconds, which
+// bounds the error of the reported percentiles to 12.5%.
+class latency_histogram
+{
+public:
+    static constexpr size_t buckets = 256;
+
+    void record(uint64_t us)
+    {
+        m_buckets[bucket(us)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(us, std::memory_order_relaxed);
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while(us > max && !m_max.compare_exchange_weak(max, us, std::memory_order_relaxed));
+    }
+
+    void reset()
+    {
+        for(auto &b : m_buckets)
+            b.store(0, std::memory_order_relaxed);
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    // adds the samples of another histogram, used to merge the per thread ones
+    void add(const latency_histogram &other)
+    {
+        for(size_t i = 0; i < buckets; ++i)
+            m_buckets[i].fetch_add(other.m_buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_count.fetch_add(other.count(), std::memory_order_relaxed);
+        m_sum.fetch_add(other.sum(), std::memory_order_relaxed);
+        uint64_t us = other.max(), max = m_max.load(std::memory_order_relaxed);
+        while(us > max && !m_max.compare_exchange_weak(max, us, std::memory_order_relaxed));
+    }
+
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+    // in microseconds, the middle of the bucket holding the quantile
+    double percentile(double q) const
+    {
+        uint64_t total = count();
+        if(total == 0)
+            return 0;
+
+        uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(q * total + 0.5), 1);
+        uint64_t seen = 0;
+        for(size_t i = 0; i < buckets; ++i) {
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+            if(seen >= rank)
+                return std::min<double>((lower_bound(i) + lower_bound(i + 1)) / 2.0, max());
+        }
+        return max();
+    }
+
+private:
+    static size_t bucket(uint64_t us)
+    {
+        if(us < 8)
+            return us;
+
+        size_t e = 63 - __builtin_clzll(us);
+        return std::min<size_t>((e - 2) * 8 + ((us >> (e - 3)) & 7), buckets - 1);
+    }
+
+    static uint64_t lower_bound(size_t i)
+    {
+        return i < 8 ? i : (8 + i % 8) << (i / 8 - 1);
+    }
+
+    std::array<std::atomic<uint64_t>, buckets> m_buckets {};
+    std::atomic<uint64_t> m_count { 0 };
+    std::atomic<uint64_t> m_sum { 0 };
+    std::atomic<uint64_t> m_max { 0 };
+};
+
+template<typename T>
+size_t packed_size(const T &v) { return fc::raw::pack_size(v); }
+template<typename S>
+size_t packed_size(const std::function<S>&) { return 0; }
+inline size_t packed_size() { return 0; }
+
+template<typename T, typename... Args>
+size_t packed_size(const T &v, const Args&... args) { return packed_size(v) + packed_size(args...); }
+
+// Counters of a single API method as updated by one group of threads.
+struct rpc_counters
+{
+    void reset()
+    {
+        calls.store(0, std::memory_order_relaxed);
+        errors.store(0, std::memory_order_relaxed);
+        coalesced.store(0, std::memory_order_relaxed);
+        bytes_sent.store(0, std::memory_order_relaxed);
+        bytes_received.store(0, std::memory_order_relaxed);
+        latency.reset();
+    }
+
+    void add(const rpc_counters &other)
+    {
+        calls.fetch_add(other.calls.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        errors.fetch_add(other.errors.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        coalesced.fetch_add(other.coalesced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bytes_sent.fetch_add(other.bytes_sent.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bytes_received.fetch_add(other.bytes_received.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        latency.add(other.latency);
+    }
+
+    std::atomic<uint64_t> calls { 0 };
+    std::atomic<uint64_t> errors { 0 };
+    std::atomic<uint64_t> coalesced { 0 };
+    std::atomic<uint64_t> bytes_sent { 0 };
+    std::atomic<uint64_t> bytes_received { 0 };
+    latency_histogram latency;
+    // keeps the shards of a record off each other's cache lines
+    char padding[64];
+};
+
+// Counters of a single API method. Every thread updates the shard it was assigned, so the
+// calling threads and the fc threads completing the calls do not share cache lines; the
+// shards are merged when the stats are read.
+struct rpc_record
+{
+    static constexpr size_t shards = 8;
+
+    rpc_record(const char *api, const char *method) : api(api), method(method) {}
+
+    template<typename T>
+    fc::future<T> track(fc::future<T> f, size_t sent, bool measure_result)
+    {
+        auto start = std::chrono::steady_clock::now();
+        rpc_counters &c = local();
+        c.calls.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_sent.fetch_add(sent, std::memory_order_relaxed);
+        return observe(std::move(f), [this, start, measure_result](const fc::exception_ptr &e, const auto&... result) {
+            rpc_counters &c = local();
+            c.latency.record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+            if(e)
+                c.errors.fetch_add(1, std::memory_order_relaxed);
+            else if(measure_result)
+                c.bytes_received.fetch_add(packed_size(result...), std::memory_order_relaxed);
+        });
+    }
+
+    rpc_counters& local()
+    {
+        static std::atomic<size_t> next { 0 };
+        static thread_local size_t shard = next++ % shards;
+        return m_shards[shard];
+    }
+
+    // the shards merged, new samples may be missing while it is taken
+    std::unique_ptr<rpc_counters> snapshot() const
+    {
+        std::unique_ptr<rpc_counters> result(new rpc_counters());
+        for(const auto &c : m_shards)
+            result->add(c);
+        return result;
+    }
+
+    void reset()
+    {
+        for(auto &c : m_shards)
+            c.reset();
+    }
+
+    const char *api;
+    const char *method;
+
+private:
+    std::array<rpc_counters, shards> m_shards;
+};
+
+// Lock free table of the per method records keyed by the API and method name.
+class rpc_stats
+{
+public:
+    static constexpr size_t slots = 512;
+
+    ~rpc_stats()
+    {
+        for(auto &slot : m_slots)
+            delete slot.load();
+    }
+
+    rpc_record& record(const char *api, const char *method)
+    {
+        size_t h = 14695981039346656037ull;
+        for(const char *c = api; *c; ++c)
+            h = (h ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+        h = (h ^ '.') * 1099511628211ull;
+        for(const char *c = method; *c; ++c)
+            h = (h ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+
+        for(size_t i = 0; i < slots; ++i) {
+            auto &slot = m_slots[(h + i) % slots];
+            rpc_record *r = slot.load(std::memory_order_acquire);
+            if(!r) {
+                std::unique_ptr<rpc_record> created(new rpc_record(api, method));
+                if(slot.compare_exchange_strong(r, created.get(), std::memory_order_acq_rel))
+                    return *created.release();
+            }
+            if(std::strcmp(r->method, method) == 0 && std::strcmp(r->api, api) == 0)
+                return *r;
+        }
+        return m_other;
+    }
+
+    void reset()
+    {
+        for(auto &slot : m_slots) {
+            if(rpc_record *r = slot.load(std::memory_order_acquire))
+                r->reset();
+        }
+        m_other.reset();
+    }
+
+    // keyed by the method name, qualified by the API when the name is used by several APIs
+    bp::dict stats() const
+    {
+        std::map<std::string, uint32_t> apis;
+        for_each([&apis](const rpc_record &r, const rpc_counters&) { ++apis[r.method]; });
+
+        bp::dict result;
+        for_each([&result, &apis](const rpc_record &r, const rpc_counters &c) {
+            bp::dict latency;
+            latency["mean"] = c.latency.count() ? c.latency.sum() / 1e6 / c.latency.count() : 0.0;
+            latency["p50"] = c.latency.percentile(0.5) / 1e6;
+            latency["p99"] = c.latency.percentile(0.99) / 1e6;
+            latency["p999"] = c.latency.percentile(0.999) / 1e6;
+            latency["max"] = c.latency.max() / 1e6;
+
+            bp::dict d;
+            d["api"] = r.api;
+            d["calls"] = c.calls.load(std::memory_order_relaxed);
+            d["errors"] = c.errors.load(std::memory_order_relaxed);
+            d["coalesced"] = c.coalesced.load(std::memory_order_relaxed);
+            d["bytes_sent"] = c.bytes_sent.load(std::memory_order_relaxed);
+            d["bytes_received"] = c.bytes_received.load(std::memory_order_relaxed);
+            d["latency"] = latency;
+            result[apis[r.method] > 1 ? std::string(r.api) + '.' + r.method : std::string(r.method)] = d;
+        });
+        return result;
+    }
+
+    std::string prometheus() const
+    {
+        std::vector<std::pair<const rpc_record*, std::unique_ptr<rpc_counters>>> records;
+        for_each([&records](const rpc_record &r, const rpc_counters &c) {
+            records.emplace_back(&r, std::unique_ptr<rpc_counters>(new rpc_counters()));
+            records.back().second->add(c);
+        });
+
+        std::ostringstream out;
+        auto counter = [&out, &records](const char *name, const char *help, std::atomic<uint64_t> rpc_counters::*value) {
+            out << "# HELP " << name << ' ' << help << "\n# TYPE " << name << " counter\n";
+            for(const auto &r : records)
+                out << name << labels(*r.first) << '}' << ' ' << ((*r.second).*value).load(std::memory_order_relaxed) << '\n';
+        };
+
+        counter("dcore_rpc_calls_total", "RPC calls issued.", &rpc_counters::calls);
+        counter("dcore_rpc_errors_total", "RPC calls failed.", &rpc_counters::errors);
+        counter("dcore_rpc_coalesced_total", "Calls served by an identical call in flight.", &rpc_counters::coalesced);
+        counter("dcore_rpc_sent_bytes_total", "Estimated RPC request bytes.", &rpc_counters::bytes_sent);
+        counter("dcore_rpc_received_bytes_total", "Estimated RPC response bytes.", &rpc_counters::bytes_received);
+
+        const char *name = "dcore_rpc_latency_seconds";
+        out << "# HELP " << name << " RPC call latency.\n# TYPE " << name << " summary\n";
+        for(const auto &r : records) {
+            const latency_histogram &latency = r.second->latency;
+            for(double q : { 0.5, 0.99, 0.999 })
+                out << name << labels(*r.first) << ",quantile=\"" << q << "\"} " << latency.percentile(q) / 1e6 << '\n';
+            out << name << "_sum" << labels(*r.first) << "} " << latency.sum() / 1e6 << '\n';
+            out << name << "_count" << labels(*r.first) << "} " << latency.count() << '\n';
+        }
+        return out.str();
+    }
+
+private:
+    static std::string labels(const rpc_record &r)
+    {
+        return std::string("{api=\"") + r.api + "\",method=\"" + r.method + '"';
+    }
+
+    template<typename F>
+    void for_each(F f) const
+    {
+        for(auto &slot : m_slots) {
+            if(rpc_record *r = slot.load(std::memory_order_acquire))
+                f(*r, *r->snapshot());
+        }
+        auto other = m_other.snapshot();
+        if(other->calls.load(std::memory_order_relaxed) || other->coalesced.load(std::memory_order_relaxed))
+            f(m_other, *other);
+    }
+
+    std::array<std::atomic<rpc_record*>, slots> m_slots {};
+    rpc_record m_other { "", "other" };
+};
+
+template<typename F>
+struct future_value;
+
+template<typename T>
+struct future_value<fc::future<T>>
+{
+    typedef T type;
+};
+
+// Appends the packed arguments to the key identifying a query, callbacks make it unique.
+inline bool append_packed(std::string&) { return true; }
+
+template<typename T, typename... Args>
+bool append_packed(std::string &key, const T &v, const Args&... args)
+{
+    std::vector<char> bytes = fc::raw::pack(v);
+    key.append(bytes.begin(), bytes.end());
+    return append_packed(key, args...);
+}
+
+template<typename S, typename... Args>
+bool append_packed(std::string&, const std::function<S>&, const Args&...) { return false; }
+
+struct inflight_query
+{
+    virtual ~inflight_query() = default;
+};
+
+// Promises of the callers waiting for the result of an identical query already in flight.
+template<typename T>
+struct inflight_waiters : inflight_query
+{
+    std::vector<typename fc::promise<T>::ptr> waiters;
+};
+
+inline std::vector<char> pack_result() { return {}; }
+
+template<typename T>
+std::vector<char> pack_result(const T &v) { return fc::raw::pack(v); }
+
+// A recording starts with the magic followed by the packed requests, each one being the
+// key identifying the request, the error, the packed result and the latency.
+static const char recording_magic[] = { 'D', 'C', 'R', 'R', 1 };
+
+// Writes the outcome of the database queries and broadcasts to a recording, see rpc_replay.
+class rpc_recorder : public std::enable_shared_from_this<rpc_recorder>
+{
+public:
+    explicit rpc_recorder(const std::string &path) : m_out(fc::path_from_utf8(path), std::ios::binary | std::ios::trunc)
+    {
+        if(!m_out)
+            throw std::runtime_error("cannot create " + path);
+        m_out.write(recording_magic, sizeof(recording_magic));
+    }
+
+    template<typename T>
+    fc::future<T> record(const std::string &key, fc::future<T> f)
+    {
+        auto self = shared_from_this();
+        auto start = std::chrono::steady_clock::now();
+        return observe(std::move(f), [self, key, start](const fc::exception_ptr &e, const auto&... result) {
+            uint64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            self->write(key, e ? e->to_detail_string() : std::string(), e ? std::vector<char>() : pack_result(result...), latency);
+        });
+    }
+
+private:
+    void write(const std::string &key, const std::string &error, const std::vector<char> &result, uint64_t latency)
+    {
+        std::vector<char> bytes(fc::raw::pack_size(key) + fc::raw::pack_size(error) + fc::raw::pack_size(result) + fc::raw::pack_size(latency));
+        fc::datastream<char*> ds(bytes.data(), bytes.size());
+        fc::raw::pack(ds, key);
+        fc::raw::pack(ds, error);
+        fc::raw::pack(ds, result);
+        fc::raw::pack(ds, latency);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_out.write(bytes.data(), bytes.size());
+    }
+
+    std::mutex m_mutex;
+    boost::filesystem::ofstream m_out;
+};
+
+struct recorded_reply
+{
+    std::string error;
+    std::vector<char> result;
+    uint64_t latency;
+};
+
+template<typename T>
+struct replay_result
+{
+    static void complete(const typename fc::promise<T>::ptr &p, const recorded_reply &reply)
+    {
+        p->set_value(fc::raw::unpack<T>(reply.result));
+    }
+};
+
+template<>
+struct replay_result<void>
+{
+    static void complete(const fc::promise<void>::ptr &p, const recorded_reply&)
+    {
+        p->set_value();
+    }
+};
+
+// Serves the requests from a recording instead of a node, the same request is answered
+// with its recorded replies in turn. Broadcasts missing in the recording succeed, the
+// replies still scheduled when the replay is stopped fail as cancelled.
+class rpc_replay
+{
+public:
+    rpc_replay(const std::string &path, double latency, bool recorded_latency)
+        : m_latency_us(static_cast<int64_t>(std::max(latency, 0.0) * 1e6)), m_recorded_latency(recorded_latency)
+    {
+        boost::filesystem::ifstream in(fc::path_from_utf8(path), std::ios::binary);
+        if(!in)
+            throw std::runtime_error("cannot open " + path);
+
+        std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if(data.size() < sizeof(recording_magic) || !std::equal(recording_magic, recording_magic + sizeof(recording_magic), data.begin()))
+            throw std::runtime_error(path + " is not a recording");
+
+        fc::datastream<const char*> ds(data.data() + sizeof(recording_magic), data.size() - sizeof(recording_magic));
+        while(ds.remaining()) {
+            std::string key;
+            recorded_reply reply;
+            fc::raw::unpack(ds, key);
+            fc::raw::unpack(ds, reply.error);
+            fc::raw::unpack(ds, reply.result);
+            fc::raw::unpack(ds, reply.latency);
+            m_replies[key].replies.push_back(std::move(reply));
+        }
+    }
+
+    ~rpc_replay()
+    {
+        std::map<uint64_t, std::function<void()>> cancel;
+        {
+            std::lock_guard<std::mutex> lock(m_scheduled->mutex);
+            cancel.swap(m_scheduled->cancel);
+        }
+        for(auto &c : cancel)
+            c.second();
+    }
+
+    template<typename T>
+    fc::future<T> reply(const std::string &key)
+    {
+        typename fc::promise<T>::ptr p(new fc::promise<T>("dcore::replay"));
+        // set by whichever of the task and the cancellation comes first
+        auto done = std::make_shared<std::atomic<bool>>(false);
+        uint64_t id;
+        {
+            std::lock_guard<std::mutex> lock(m_scheduled->mutex);
+            id = m_scheduled->next++;
+            m_scheduled->cancel[id] = [p, done]() {
+                if(done->exchange(true))
+                    return;
+                try {
+                    FC_THROW_EXCEPTION(fc::canceled_exception, "replay stopped");
+                }
+                catch(const fc::exception &e) {
+                    p->set_exception(e.dynamic_copy_exception());
+                }
+            };
+        }
+
+        // copied, the replay may be stopped or replaced before the task runs
+        const recorded_reply *found = next(key);
+        bool recorded = found != nullptr;
+        recorded_reply reply = recorded ? *found : recorded_reply();
+        fc::microseconds delay(recorded && m_recorded_latency ? reply.latency : m_latency_us);
+        std::weak_ptr<scheduled_replies> scheduled = m_scheduled;
+        m_thread.schedule([p, done, scheduled, id, recorded, reply, key]() {
+            if(auto s = scheduled.lock()) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->cancel.erase(id);
+            }
+            if(done->exchange(true))
+                return;
+
+            try {
+                if(!recorded && !std::is_void<T>::value)
+                    FC_THROW("request ${method} not recorded", ("method", key.c_str()));
+                if(!reply.error.empty())
+                    FC_THROW("${e}", ("e", reply.error));
+                replay_result<T>::complete(p, reply);
+            }
+            catch(const fc::exception &e) {
+                p->set_exception(e.dynamic_copy_exception());
+            }
+        }, fc::time_point::now() + delay, "dcore::replay");
+        return fc::future<T>(p);
+    }
+
+private:
+    struct recorded_replies
+    {
+        std::vector<recorded_reply> replies;
+        std::atomic<size_t> next { 0 };
+    };
+
+    // cancellations of the replies not sent yet, by request
+    struct scheduled_replies
+    {
+        std::mutex mutex;
+        std::map<uint64_t, std::function<void()>> cancel;
+        uint64_t next = 0;
+    };
+
+    const recorded_reply* next(const std::string &key)
+    {
+        auto it = m_replies.find(key);
+        if(it == m_replies.end())
+            return nullptr;
+
+        auto &r = it->second;
+        return &r.replies[r.next.fetch_add(1, std::memory_order_relaxed) % r.replies.size()];
+    }
+
+    std::unordered_map<std::string, recorded_replies> m_replies;
+    std::shared_ptr<scheduled_replies> m_scheduled = std::make_shared<scheduled_replies>();
+    int64_t m_latency_us;
+    bool m_recorded_latency;
+    fc::thread m_thread { "dcore::replay" };
+};
+
+// One connection of a pooled Wallet, tracks the requests it serves.
+class pool_connection : public std::enable_shared_from_this<pool_connection>
+{
+public:
+    pool_connection(const std::string &server, wa::WalletAPI *api, std::unique_ptr<wa::WalletAPI> owned = nullptr)
+        : m_server(server), m_api(api), m_owned(std::move(owned)) {}
+
+    wa::WalletAPI& api() { return *m_api; }
+    bool healthy() const { return m_healthy; }
+    uint32_t outstanding() const { return m_outstanding; }
+
+    template<typename T>
+    fc::future<T> track(fc::future<T> f)
+    {
+        auto self = shared_from_this();
+        auto start = std::chrono::steady_clock::now();
+        ++m_outstanding;
+        ++m_requests;
+        return observe(std::move(f), [self, start](const fc::exception_ptr &e, const auto&...) { self->done(start, e); });
+    }
+
+    bp::dict status() const
+    {
+        bp::dict result;
+        result["server"] = m_server;
+        result["healthy"] = m_healthy.load();
+        result["outstanding"] = m_outstanding.load();
+        result["requests"] = m_requests.load();
+        result["errors"] = m_errors.load();
+        result["latency"] = m_latency_us / 1e6;
+        return result;
+    }
+
+private:
+    void done(std::chrono::steady_clock::time_point start, const fc::exception_ptr &e)
+    {
+        --m_outstanding;
+        if(e) {
+            ++m_errors;
+            // failed queries say nothing about the connection, a closed socket does
+            if(e->code() == fc::eof_exception_code || e->code() == fc::canceled_exception_code) {
+                m_healthy = false;
+                return;
+            }
+        }
+
+        m_healthy = true;
+        int64_t sample = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        int64_t latency = m_latency_us;
+        m_latency_us = latency == 0 ? sample : (latency * 7 + sample) / 8;
+    }
+
+    std::string m_server;
+    wa::WalletAPI *m_api;
+    std::unique_ptr<wa::WalletAPI> m_owned;
+    std::atomic<bool> m_healthy { true };
+    std::atomic<uint32_t> m_outstanding { 0 };
+    std::atomic<uint64_t> m_requests { 0 };
+    std::atomic<uint64_t> m_errors { 0 };
+    std::atomic<int64_t> m_latency_us { 0 };
+};
+
+// Connections of a pooled Wallet, replaced as a whole on every connect_pool.
+struct connection_pool
+{
+    // the query connections load keyless wallets of their own, removed with the pool
+    struct scratch_directory
+    {
+        ~scratch_directory()
+        {
+            boost::system::error_code ec;
+            if(!path.empty())
+                boost::filesystem::remove_all(path, ec);
+        }
+
+        boost::filesystem::path path;
+    };
+
+    scratch_directory wallets;
+    std::vector<std::shared_ptr<pool_connection>> connections;
+    bool least_outstanding = false;
+};
+
+struct Wallet : public wa::WalletAPI
+{
+    void connect(const std::string &wallet_file, const std::string &server, const std::string &user, const std::string &password)
+    {
+        gil_release nogil;
+        std::atomic_store(&m_pool, std::shared_ptr<const connection_pool>());
+        Connect(fc::path_from_utf8(wallet_file), { server, user, password });
+    }
+
+    // The first server is the primary connection used by the wallet and for broadcasting,
+    // the read only queries are spread over all the connections. Only the primary one loads
+    // the wallet file, the others connect with empty wallets in a scratch directory.
+    void connect_pool(const std::string &wallet_file, const bp::list &servers, uint32_t connections, const std::string &user, const std::string &password,
+                      const std::string &strategy)
+    {
+        std::vector<std::string> urls = vector_from_list<std::string>(servers);
+        if(urls.empty())
+            urls.emplace_back();
+
+        if(strategy != "round_robin" && strategy != "least_outstanding")
+            throw std::invalid_argument("strategy must be 'round_robin' or 'least_outstanding'");
+
+        gil_release nogil;
+        std::atomic_store(&m_pool, std::shared_ptr<const connection_pool>());
+        Connect(fc::path_from_utf8(wallet_file), { urls.front(), user, password });
+
+        auto pool = std::make_shared<connection_pool>();
+        pool->least_outstanding = strategy == "least_outstanding";
+        pool->wallets.path = graphene::utilities::decent_path_finder::instance().get_decent_temp() / boost::filesystem::unique_path("pool-%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(pool->wallets.path);
+        pool->connections.push_back(std::make_shared<pool_connection>(urls.front(), this));
+        for(size_t n = 0; n < urls.size(); ++n) {
+            // the primary connection is the first one to the first server
+            for(uint32_t i = n == 0 ? 1 : 0; i < connections; ++i) {
+                std::unique_ptr<wa::WalletAPI> api(new wa::WalletAPI());
+                api->Connect(pool->wallets.path / ("wallet-" + std::to_string(pool->connections.size()) + ".json"), { urls[n], user, password });
+                pool->connections.push_back(std::make_shared<pool_connection>(urls[n], api.get(), std::move(api)));
+            }
+        }
+
+        std::atomic_store(&m_pool, std::shared_ptr<const connection_pool>(std::move(pool)));
+    }
+
+    bp::list pool_status() const
+    {
+        bp::list result;
+        if(auto pool = std::atomic_load(&m_pool)) {
+            for(const auto &c : pool->connections)
+                result.append(c->status());
+        }
+        return result;
+    }
+
+    // the GIL is released while waiting for the result, see pending::wait; wallet calls run
+    // in process, so only the sizes of database and network calls are accounted
+    template<typename Method, typename... Args>
+    auto exec(const char *name, Method method, Args&&... args)
+    {
+        return make_pending(m_stats.record("wallet", name).track(wa::WalletAPI::exec(method, std::forward<Args>(args)...), 0, false), call_deadline());
+    }
+
+    // with coalesce set, identical queries in flight are sent once and the later callers share the result
+    template<typename Method, typename... Args>
+    auto query(const char *name, Method method, Args&&... args)
+    {
+        typedef typename future_value<decltype(wa::WalletAPI::query(method, std::forward<Args>(args)...))>::type result_type;
+        rpc_record &r = m_stats.record("database", name);
+        std::string key(name);
+        key.push_back('\0');
+        bool keyed = append_packed(key, args...);
+        size_t sent = packed_size(args...);
+
+        auto send = [this, &r, &key, keyed, sent, method, &args...]() {
+            return r.track(dispatch<result_type>(key, keyed, [this, method, &args...]() {
+                auto pool = std::atomic_load(&m_pool);
+                if(!pool)
+                    return wa::WalletAPI::query(method, args...);
+
+                pool_connection &c = select(*pool);
+                return c.track(c.api().query(method, args...));
+            }), sent, true);
+        };
+
+        if(!m_coalesce || !keyed)
+            return make_pending(send(), call_deadline());
+
+        return make_pending(coalesced<result_type>(r, key, send), call_deadline());
+    }
 
-void configure_logging(const std::string &config)
-{
-    fc::configure_logging(fc::json::from_string(config).as<fc::logging_config>());
-}
+    template<typename Method, typename... Args>
+    auto broadcast(const char *name, Method method, Args&&... args)
+    {
+        typedef typename future_value<decltype(wa::WalletAPI::broadcast(method, std::forward<Args>(args)...))>::type result_type;
+        rpc_record &r = m_stats.record("network_broadcast", name);
+        std::string key;
+        bool keyed = false;
+        if(std::atomic_load(&m_replay) || std::atomic_load(&m_recorder)) {
+            key = name;
+            key.push_back('\0');
+            keyed = append_packed(key, args...);
+        }
 
-std::string default_logging()
-{
-    return fc::json::to_pretty_string(fc::logging_config::default_config());
-}
+        size_t sent = packed_size(args...);
+        auto send = [this, method, &args...]() { return wa::WalletAPI::broadcast(method, args...); };
+        return make_pending(r.track(dispatch<result_type>(key, keyed, send), sent, true), call_deadline());
+    }
 
-struct Wallet : public wa::WalletAPI
-{
-    void connect(const std::string &wallet_file, const std::string &server, const std::string &user, const std::string &password)
+    // database queries and broadcasts are written to the file until stop_recording
+    void start_recording(const std::string &path) { std::atomic_store(&m_recorder, std::make_shared<rpc_recorder>(path)); }
+    void stop_recording() { std::atomic_store(&m_recorder, std::shared_ptr<rpc_recorder>()); }
+
+    // serves the database queries and broadcasts from a recording instead of the node
+    void replay(const std::string &path, double latency, bool recorded_latency)
+        { std::atomic_store(&m_replay, std::make_shared<rpc_replay>(path, latency, recorded_latency)); }
+    void stop_replay() { std::atomic_store(&m_replay, std::shared_ptr<rpc_replay>()); }
+
+    // the deadline of the calling thread takes precedence over the default timeout, both
+    // are fixed when the call is made
+    fc::time_point call_deadline() const
     {
-        Connect(fc::path_from_utf8(wallet_file), { server, user, password });
+        const thread_deadline &deadline = current_deadline();
+        if(deadline.active)
+            return fc::time_point::now() + fc::microseconds(std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(deadline.at - std::chrono::steady_clock::now()).count(), 0));
+
+        int64_t timeout = m_timeout_us;
+        return timeout > 0 ? fc::time_point::now() + fc::microseconds(timeout) : fc::time_point::maximum();
     }
 
+    double get_timeout() const { return m_timeout_us / 1e6; }
+    void set_timeout(double timeout) { m_timeout_us = timeout > 0 ? static_cast<int64_t>(timeout * 1e6) : 0; }
+
+    bool get_coalesce() const { return m_coalesce; }
+    void set_coalesce(bool coalesce) { m_coalesce = coalesce; }
+
+    bp::dict stats() const { return m_stats.stats(); }
+    void reset_stats() { m_stats.reset(); }
+    std::string stats_prometheus() const { return m_stats.prometheus(); }
+
     // wallet file
-    bool is_new() { return exec(&wa::wallet_api::is_new).wait(); }
-    bool is_locked() { return exec(&wa::wallet_api::is_locked).wait(); }
-    bool lock() { return exec(&wa::wallet_api::lock).wait(); }
-    bool unlock(const std::string &password) { return exec(&wa::wallet_api::unlock, password).wait(); }
-    void set_password(const std::string &password) { exec(&wa::wallet_api::set_password, password).wait(); }
-    void save(const std::string &wallet_file) { exec(&wa::wallet_api::save_wallet_file, fc::path_from_utf8(wallet_file)).wait(); }
-    bool load(const std::string &wallet_file) { return exec(&wa::wallet_api::load_wallet_file, fc::path_from_utf8(wallet_file)).wait(); }
-    std::string get_filename() { return fc::path_to_utf8(exec(&wa::wallet_api::get_wallet_filename).wait()); }
-    bool import_key(const std::string &account, const std::string &key) { return exec(&wa::wallet_api::import_key, account, key).wait(); }
-    bool import_single_key(const std::string &account, const std::string &key) { return exec(&wa::wallet_api::import_single_key, account, key).wait(); }
-    std::string get_private_key(const ch::public_key_type &pubkey) { return exec(&wa::wallet_api::get_private_key, pubkey).wait(); }
-    std::string dump_private_keys() { return object_repr(exec(&wa::wallet_api::dump_private_keys).wait()); }
-    bp::list list_my_accounts() { return to_list(exec(&wa::wallet_api::list_my_accounts).wait()); }
+    bool is_new() { return exec("is_new", &wa::wallet_api::is_new).wait(); }
+    bool is_locked() { return exec("is_locked", &wa::wallet_api::is_locked).wait(); }
+    bool lock() { return exec("lock", &wa::wallet_api::lock).wait(); }
+    bool unlock(const std::string &password) { return exec("unlock", &wa::wallet_api::unlock, password).wait(); }
+    void set_password(const std::string &password) { exec("set_password", &wa::wallet_api::set_password, password).wait(); }
+    void save(const std::string &wallet_file) { exec("save_wallet_file", &wa::wallet_api::save_wallet_file, fc::path_from_utf8(wallet_file)).wait(); }
+    bool load(const std::string &wallet_file) { return exec("load_wallet_file", &wa::wallet_api::load_wallet_file, fc::path_from_utf8(wallet_file)).wait(); }
+    std::string get_filename() { return fc::path_to_utf8(exec("get_wallet_filename", &wa::wallet_api::get_wallet_filename).wait()); }
+    bool import_key(const std::string &account, const std::string &key) { return exec("import_key", &wa::wallet_api::import_key, account, key).wait(); }
+    bool import_single_key(const std::string &account, const std::string &key) { return exec("import_single_key", &wa::wallet_api::import_single_key, account, key).wait(); }
+    std::string get_private_key(const ch::public_key_type &pubkey) { return exec("get_private_key", &wa::wallet_api::get_private_key, pubkey).wait(); }
+    std::string dump_private_keys() { return object_repr(exec("dump_private_keys", &wa::wallet_api::dump_private_keys).wait()); }
+    bp::list list_my_accounts() { return to_list(exec("list_my_accounts", &wa::wallet_api::list_my_accounts).wait()); }
 
     // general
-    decent::about_info about() { return query(&wa::db_api::about).wait(); }
-    wa::wallet_info info() { return exec(&wa::wallet_api::info).wait(); }
-    ch::configuration get_configuration() { return query(&wa::db_api::get_configuration).wait(); }
-    ch::chain_property_object get_chain_properties() { return query(&wa::db_api::get_chain_properties).wait(); }
-    ch::global_property_object get_global_properties() { return query(&wa::db_api::get_global_properties).wait(); }
-    ch::dynamic_global_property_object get_dynamic_global_properties() { return query(&wa::db_api::get_dynamic_global_properties).wait(); }
-    bp::object get_block(uint32_t num) { return encode_optional_value(query(&wa::db_api::get_block, num).wait()); }
-    fc::time_point_sec head_block_time() { return query(&wa::db_api::head_block_time).wait(); }
-    ch::real_supply get_real_supply() { return query(&wa::db_api::get_real_supply).wait(); }
-    uint64_t get_new_asset_per_block() { return to_safe_value(query(&wa::db_api::get_new_asset_per_block).wait()); }
-    uint64_t get_new_asset_by_block(uint32_t block_num) { return to_safe_value(query(&wa::db_api::get_asset_per_block_by_block_num, block_num).wait()); }
-    uint64_t get_miner_pay(fc::time_point_sec block_time) { return to_safe_value(query(&wa::db_api::get_miner_pay_from_fees_by_block_time, block_time).wait()); }
+    decent::about_info about() { return query("about", &wa::db_api::about).wait(); }
+    wa::wallet_info info() { return exec("info", &wa::wallet_api::info).wait(); }
+    ch::configuration get_configuration() { return query("get_configuration", &wa::db_api::get_configuration).wait(); }
+    ch::chain_property_object get_chain_properties()
+        { return cached(m_chain_properties, 0, [this](uint32_t) { return query("get_chain_properties", &wa::db_api::get_chain_properties).wait(); }); }
+    ch::global_property_object get_global_properties()
+        { return cached(m_global_properties, 0, [this](uint32_t) { return query("get_global_properties", &wa::db_api::get_global_properties).wait(); }); }
+    ch::dynamic_global_property_object get_dynamic_global_properties() { return query("get_dynamic_global_properties", &wa::db_api::get_dynamic_global_properties).wait(); }
+    bp::object get_block(uint32_t num) { return encode_optional_value(query("get_block", &wa::db_api::get_block, num).wait()); }
+    fc::time_point_sec head_block_time() { return query("head_block_time", &wa::db_api::head_block_time).wait(); }
+    ch::real_supply get_real_supply() { return query("get_real_supply", &wa::db_api::get_real_supply).wait(); }
+    uint64_t get_new_asset_per_block() { return to_safe_value(query("get_new_asset_per_block", &wa::db_api::get_new_asset_per_block).wait()); }
+    uint64_t get_new_asset_by_block(uint32_t block_num) { return to_safe_value(query("get_asset_per_block_by_block_num", &wa::db_api::get_asset_per_block_by_block_num, block_num).wait()); }
+    uint64_t get_miner_pay(fc::time_point_sec block_time) { return to_safe_value(query("get_miner_pay_from_fees_by_block_time", &wa::db_api::get_miner_pay_from_fees_by_block_time, block_time).wait()); }
 
     // account
-    uint64_t get_account_count() { return query(&wa::db_api::get_account_count).wait(); }
-    bp::object get_account(const std::string& name) { return encode_optional_value(query(&wa::db_api::get_account_by_name, name).wait()); }
-    bp::dict lookup_accounts(const std::string& lowerbound, uint32_t limit) { return to_dict(query(&wa::db_api::lookup_accounts, lowerbound, limit).wait()); }
-    bp::list search_accounts(const std::string& term, const std::string& order, graphene::db::object_id_type id, uint32_t limit) { return to_list(query(&wa::db_api::search_accounts, term, order, id, limit).wait()); }
-    bp::list get_accounts(const bp::list& ids) { return to_optional_list(query(&wa::db_api::get_accounts, vector_from_list<ch::account_id_type>(ids)).wait()); }
-    bp::list list_account_balances(const std::string& account) { return to_list(exec(&wa::wallet_api::list_account_balances, account).wait()); }
+    uint64_t get_account_count() { return query("get_account_count", &wa::db_api::get_account_count).wait(); }
+    bp::object get_account(const std::string& name)
+    {
+        return encode_optional_value(cached(m_account_names, name, [this, &name](uint32_t head) {
+            auto account = query("get_account_by_name", &wa::db_api::get_account_by_name, name).wait();
+            if(account)
+                m_accounts.put(account->get_id(), head, account);
+            return account;
+        }));
+    }
+    bp::dict lookup_accounts(const std::string& lowerbound, uint32_t limit) { return to_dict(query("lookup_accounts", &wa::db_api::lookup_accounts, lowerbound, limit).wait()); }
+    bp::list search_accounts(const std::string& term, const std::string& order, graphene::db::object_id_type id, uint32_t limit) { return to_list(query("search_accounts", &wa::db_api::search_accounts, term, order, id, limit).wait()); }
+    bp::list get_accounts(const bp::list& ids)
+    {
+        return to_optional_list(cached(m_accounts, vector_from_list<ch::account_id_type>(ids), "get_accounts", &wa::db_api::get_accounts,
+            [this](uint32_t head, const fc::optional<ch::account_object> &account) { m_account_names.put(account->name, head, account); }));
+    }
+    bp::list list_account_balances(const std::string& account) { return to_list(exec("list_account_balances", &wa::wallet_api::list_account_balances, account).wait()); }
     ch::signed_transaction create_account(const std::string &brainkey, const std::string &name, const std::string &registrar, bool broadcast)
-        { return exec(&wa::wallet_api::create_account_with_brain_key, brainkey, name, registrar, broadcast).wait(); }
+        { return exec("create_account_with_brain_key", &wa::wallet_api::create_account_with_brain_key, brainkey, name, registrar, broadcast).wait(); }
     ch::signed_transaction register_account(const std::string &name, const ch::public_key_type &owner, const ch::public_key_type &active, const ch::public_key_type &memo,
-        const std::string &registrar, bool broadcast) { return exec(&wa::wallet_api::register_account_with_keys, name, owner, active, memo, registrar, broadcast).wait(); }
+        const std::string &registrar, bool broadcast) { return exec("register_account_with_keys", &wa::wallet_api::register_account_with_keys, name, owner, active, memo, registrar, broadcast).wait(); }
     ch::signed_transaction register_multisig_account(const std::string &name, const ch::authority &owner, const ch::authority &active, const ch::public_key_type &memo,
-        const std::string &registrar, bool broadcast) { return exec(&wa::wallet_api::register_multisig_account, name, owner, active, memo, registrar, broadcast).wait(); }
+        const std::string &registrar, bool broadcast) { return exec("register_multisig_account", &wa::wallet_api::register_multisig_account, name, owner, active, memo, registrar, broadcast).wait(); }
     ch::signed_transaction update_account(const std::string &name, const ch::public_key_type &owner, const ch::public_key_type &active, const ch::public_key_type &memo, bool broadcast)
-        { return exec(&wa::wallet_api::update_account_keys, name, static_cast<std::string>(owner), static_cast<std::string>(active), static_cast<std::string>(memo), broadcast).wait(); }
+        { return exec("update_account_keys", &wa::wallet_api::update_account_keys, name, static_cast<std::string>(owner), static_cast<std::string>(active), static_cast<std::string>(memo), broadcast).wait(); }
     ch::signed_transaction update_multisig_account(const std::string &name, const ch::authority &owner, const ch::authority &active, const ch::public_key_type &memo, bool broadcast)
-        { return exec(&wa::wallet_api::update_account_keys_to_multisig, name, owner, active, memo, broadcast).wait(); }
+        { return exec("update_account_keys_to_multisig", &wa::wallet_api::update_account_keys_to_multisig, name, owner, active, memo, broadcast).wait(); }
     ch::signed_transaction transfer(const std::string &from, const std::string &to, double amount, const std::string &symbol, const std::string &memo, bool broadcast)
-        { return exec(&wa::wallet_api::transfer, from, to, fc::to_string(amount), symbol, memo, broadcast).wait(); }
+        { return exec("transfer", &wa::wallet_api::transfer, from, to, fc::to_string(amount), symbol, memo, broadcast).wait(); }
 
     // asset
-    bp::list list_assets(const std::string& lowerbound, uint32_t limit) { return to_list(query(&wa::db_api::list_assets, lowerbound, limit).wait()); }
-    bp::list get_assets(const bp::list& ids) { return to_optional_list(query(&wa::db_api::get_assets, vector_from_list<ch::asset_id_type>(ids)).wait()); }
+    bp::list list_assets(const std::string& lowerbound, uint32_t limit) { return to_list(query("list_assets", &wa::db_api::list_assets, lowerbound, limit).wait()); }
+    bp::list get_assets(const bp::list& ids) { return to_optional_list(cached(m_assets, vector_from_list<ch::asset_id_type>(ids), "get_assets", &wa::db_api::get_assets)); }
     ch::signed_transaction create_monitored_asset(const std::string &issuer, const std::string &symbol, uint8_t precision, const std::string &description, uint32_t feed_lifetime_sec, uint8_t minimum_feeds, bool broadcast)
-        { return exec(&wa::wallet_api::create_monitored_asset, issuer, symbol, precision, description, feed_lifetime_sec, minimum_feeds, broadcast).wait(); }
+        { return exec("create_monitored_asset", &wa::wallet_api::create_monitored_asset, issuer, symbol, precision, description, feed_lifetime_sec, minimum_feeds, broadcast).wait(); }
     ch::signed_transaction update_monitored_asset(const std::string &symbol, const std::string &description, uint32_t feed_lifetime_sec, uint8_t minimum_feeds, bool broadcast)
-        { return exec(&wa::wallet_api::update_monitored_asset, symbol, description, feed_lifetime_sec, minimum_feeds, broadcast).wait(); }
+        { return exec("update_monitored_asset", &wa::wallet_api::update_monitored_asset, symbol, description, feed_lifetime_sec, minimum_feeds, broadcast).wait(); }
     ch::signed_transaction create_user_issued_asset(const std::string& issuer, const std::string& symbol, uint8_t precision, const std::string& description, uint64_t max_supply, const ch::price& core_exchange_rate,
-        bool exchangeable, bool fixed_max_supply, bool broadcast) { return exec(&wa::wallet_api::create_user_issued_asset, issuer, symbol, precision, description, max_supply, core_exchange_rate, exchangeable, fixed_max_supply, broadcast).wait(); }
+        bool exchangeable, bool fixed_max_supply, bool broadcast) { return exec("create_user_issued_asset", &wa::wallet_api::create_user_issued_asset, issuer, symbol, precision, description, max_supply, core_exchange_rate, exchangeable, fixed_max_supply, broadcast).wait(); }
     ch::signed_transaction update_user_issued_asset(const std::string& symbol, const std::string& issuer, const std::string& description, uint64_t max_supply, const ch::price& core_exchange_rate,
-        bool exchangeable, bool broadcast) { return exec(&wa::wallet_api::update_user_issued_asset, symbol, issuer, description, max_supply, core_exchange_rate, exchangeable, broadcast).wait(); }
+        bool exchangeable, bool broadcast) { return exec("update_user_issued_asset", &wa::wallet_api::update_user_issued_asset, symbol, issuer, description, max_supply, core_exchange_rate, exchangeable, broadcast).wait(); }
     ch::signed_transaction issue_asset(const std::string& account, double amount, const std::string& symbol, const std::string& memo, bool broadcast)
-        { return exec(&wa::wallet_api::issue_asset, account, fc::to_string(amount), symbol, memo, broadcast).wait(); }
+        { return exec("issue_asset", &wa::wallet_api::issue_asset, account, fc::to_string(amount), symbol, memo, broadcast).wait(); }
     ch::signed_transaction fund_asset_pools(const std::string& account, double uia_amount, const std::string& uia_symbol, double dct_amount, const std::string& dct_symbol, bool broadcast)
-        { return exec(&wa::wallet_api::fund_asset_pools, account, fc::to_string(uia_amount), uia_symbol, fc::to_string(dct_amount), dct_symbol, broadcast).wait(); }
+        { return exec("fund_asset_pools", &wa::wallet_api::fund_asset_pools, account, fc::to_string(uia_amount), uia_symbol, fc::to_string(dct_amount), dct_symbol, broadcast).wait(); }
     ch::signed_transaction reserve_asset(const std::string& account, double amount, const std::string& symbol, bool broadcast)
-        { return exec(&wa::wallet_api::reserve_asset, account, fc::to_string(amount), symbol, broadcast).wait(); }
+        { return exec("reserve_asset", &wa::wallet_api::reserve_asset, account, fc::to_string(amount), symbol, broadcast).wait(); }
     ch::signed_transaction claim_fees(double uia_amount, const std::string& uia_symbol, double dct_amount, const std::string& dct_symbol, bool broadcast)
-        { return exec(&wa::wallet_api::claim_fees, fc::to_string(uia_amount), uia_symbol, fc::to_string(dct_amount), dct_symbol, broadcast).wait(); }
+        { return exec("claim_fees", &wa::wallet_api::claim_fees, fc::to_string(uia_amount), uia_symbol, fc::to_string(dct_amount), dct_symbol, broadcast).wait(); }
     ch::signed_transaction publish_asset_feed(const std::string& account, const std::string& symbol, const ch::price_feed& feed, bool broadcast)
-        { return exec(&wa::wallet_api::publish_asset_feed, account, symbol, feed, broadcast).wait(); }
+        { return exec("publish_asset_feed", &wa::wallet_api::publish_asset_feed, account, symbol, feed, broadcast).wait(); }
 
     // miner
-    uint64_t get_miner_count() { return query(&wa::db_api::get_miner_count).wait(); }
-    bp::dict list_miners(const std::string& lowerbound, uint32_t limit) { return to_dict(query(&wa::db_api::lookup_miner_accounts, lowerbound, limit).wait()); }
-    bp::list get_miners(const bp::list& ids) { return to_optional_list(query(&wa::db_api::get_miners, vector_from_list<ch::miner_id_type>(ids)).wait()); }
-    bp::object get_miner_by_account(ch::account_id_type id) { return encode_optional_value(query(&wa::db_api::get_miner_by_account, id).wait()); }
-    bp::list get_vesting_balances(ch::account_id_type id) { return to_list(query(&wa::db_api::get_vesting_balances, id).wait()); }
+    uint64_t get_miner_count() { return query("get_miner_count", &wa::db_api::get_miner_count).wait(); }
+    bp::dict list_miners(const std::string& lowerbound, uint32_t limit) { return to_dict(query("lookup_miner_accounts", &wa::db_api::lookup_miner_accounts, lowerbound, limit).wait()); }
+    bp::list get_miners(const bp::list& ids) { return to_optional_list(query("get_miners", &wa::db_api::get_miners, vector_from_list<ch::miner_id_type>(ids)).wait()); }
+    bp::object get_miner_by_account(ch::account_id_type id) { return encode_optional_value(query("get_miner_by_account", &wa::db_api::get_miner_by_account, id).wait()); }
+    bp::list get_vesting_balances(ch::account_id_type id) { return to_list(query("get_vesting_balances", &wa::db_api::get_vesting_balances, id).wait()); }
     ch::signed_transaction create_miner(const std::string &account, const std::string &url, bool broadcast)
-        { return exec(&wa::wallet_api::create_miner, account, url, broadcast).wait(); }
+        { return exec("create_miner", &wa::wallet_api::create_miner, account, url, broadcast).wait(); }
     ch::signed_transaction update_miner(const std::string &miner, const std::string &url, const ch::public_key_type &signing_key, bool broadcast)
-        { return exec(&wa::wallet_api::update_miner, miner, url, static_cast<std::string>(signing_key), broadcast).wait(); }
+        { return exec("update_miner", &wa::wallet_api::update_miner, miner, url, static_cast<std::string>(signing_key), broadcast).wait(); }
     ch::signed_transaction withdraw_vesting(const std::string& miner, double amount, const std::string& symbol, bool broadcast)
-        { return exec(&wa::wallet_api::withdraw_vesting, miner, fc::to_string(amount), symbol, broadcast).wait(); }
+        { return exec("withdraw_vesting", &wa::wallet_api::withdraw_vesting, miner, fc::to_string(amount), symbol, broadcast).wait(); }
 
     // voting
-    bp::list list_votes(const bp::list& ids) { return to_optional_list(query(&wa::db_api::lookup_vote_ids, vector_from_list<ch::vote_id_type>(ids)).wait()); }
-    bp::list get_actual_votes() { return to_list(query(&wa::db_api::get_actual_votes).wait()); }
+    bp::list list_votes(const bp::list& ids) { return to_optional_list(query("lookup_vote_ids", &wa::db_api::lookup_vote_ids, vector_from_list<ch::vote_id_type>(ids)).wait()); }
+    bp::list get_actual_votes() { return to_list(query("get_actual_votes", &wa::db_api::get_actual_votes).wait()); }
     bp::list search_miner_voting(const std::string& account, const std::string& term, bool only_my_votes, const std::string& order, const std::string& id, uint32_t limit)
-        { return to_list(query(&wa::db_api::search_miner_voting, account, term, only_my_votes, order, id, limit).wait()); }
+        { return to_list(query("search_miner_voting", &wa::db_api::search_miner_voting, account, term, only_my_votes, order, id, limit).wait()); }
     ch::signed_transaction vote_for_miner(const std::string& account, const std::string& miner, bool approve, bool broadcast)
-        { return exec(&wa::wallet_api::vote_for_miner, account, miner, approve, broadcast).wait(); }
+        { return exec("vote_for_miner", &wa::wallet_api::vote_for_miner, account, miner, approve, broadcast).wait(); }
     ch::signed_transaction set_voting_proxy(const std::string& account, const bp::object& voting_account, bool broadcast)
-        { return exec(&wa::wallet_api::set_voting_proxy, account, decode_optional_value<std::string>(voting_account), broadcast).wait(); }
+        { return exec("set_voting_proxy", &wa::wallet_api::set_voting_proxy, account, decode_optional_value<std::string>(voting_account), broadcast).wait(); }
     ch::signed_transaction set_desired_miner_count(const std::string& account, uint16_t number_of_miners, bool broadcast)
-        { return exec(&wa::wallet_api::set_desired_miner_count, account, number_of_miners, broadcast).wait(); }
+        { return exec("set_desired_miner_count", &wa::wallet_api::set_desired_miner_count, account, number_of_miners, broadcast).wait(); }
 
     // non fungible token
-    bp::list list_non_fungible_tokens(const std::string& lowerbound, uint32_t limit) { return to_list(query(&wa::db_api::list_non_fungible_tokens, lowerbound, limit).wait()); }
-    bp::list get_non_fungible_tokens(const bp::list& ids) { return to_optional_list(query(&wa::db_api::get_non_fungible_tokens, vector_from_list<ch::non_fungible_token_id_type>(ids)).wait()); }
-    bp::list list_non_fungible_token_data(ch::non_fungible_token_id_type nft) { return to_list(query(&wa::db_api::list_non_fungible_token_data, nft).wait()); }
-    bp::dict get_non_fungible_token_summary(ch::account_id_type account) { return to_dict(query(&wa::db_api::get_non_fungible_token_summary, account).wait()); }
-    bp::list get_non_fungible_token_balances(const std::string& account, const bp::list& nfts) { return to_list(exec(&wa::wallet_api::get_non_fungible_token_balances, account, set_from_list<std::string>(nfts)).wait()); }
+    bp::list list_non_fungible_tokens(const std::string& lowerbound, uint32_t limit) { return to_list(query("list_non_fungible_tokens", &wa::db_api::list_non_fungible_tokens, lowerbound, limit).wait()); }
+    bp::list get_non_fungible_tokens(const bp::list& ids) { return to_optional_list(query("get_non_fungible_tokens", &wa::db_api::get_non_fungible_tokens, vector_from_list<ch::non_fungible_token_id_type>(ids)).wait()); }
+    bp::list list_non_fungible_token_data(ch::non_fungible_token_id_type nft) { return to_list(query("list_non_fungible_token_data", &wa::db_api::list_non_fungible_token_data, nft).wait()); }
+    bp::dict get_non_fungible_token_summary(ch::account_id_type account) { return to_dict(query("get_non_fungible_token_summary", &wa::db_api::get_non_fungible_token_summary, account).wait()); }
+    bp::list get_non_fungible_token_balances(const std::string& account, const bp::list& nfts) { return to_list(exec("get_non_fungible_token_balances", &wa::wallet_api::get_non_fungible_token_balances, account, set_from_list<std::string>(nfts)).wait()); }
     ch::signed_transaction create_non_fungible_token(const std::string& issuer, const std::string& symbol, const std::string& description, const bp::list& definitions, uint32_t max_supply, bool fixed_max_supply, bool transferable,
-        bool broadcast) { return exec(&wa::wallet_api::create_non_fungible_token, issuer, symbol, description, vector_from_list<ch::non_fungible_token_data_type>(definitions), max_supply, fixed_max_supply, transferable, broadcast).wait(); }
+        bool broadcast) { return exec("create_non_fungible_token", &wa::wallet_api::create_non_fungible_token, issuer, symbol, description, vector_from_list<ch::non_fungible_token_data_type>(definitions), max_supply, fixed_max_supply, transferable, broadcast).wait(); }
     ch::signed_transaction update_non_fungible_token(const std::string& issuer, const std::string& symbol, const std::string& description, uint32_t max_supply, bool fixed_max_supply, bool broadcast)
-        { return exec(&wa::wallet_api::update_non_fungible_token, issuer, symbol, description, max_supply, fixed_max_supply, broadcast).wait(); }
+        { return exec("update_non_fungible_token", &wa::wallet_api::update_non_fungible_token, issuer, symbol, description, max_supply, fixed_max_supply, broadcast).wait(); }
     ch::signed_transaction issue_non_fungible_token(const std::string& account, const std::string& symbol, const bp::list& data, const std::string& memo, bool broadcast)
-        { return exec(&wa::wallet_api::issue_non_fungible_token, account, symbol, vector_from_list<fc::variant>(data), memo, broadcast).wait(); }
+        { return exec("issue_non_fungible_token", &wa::wallet_api::issue_non_fungible_token, account, symbol, vector_from_list<fc::variant>(data), memo, broadcast).wait(); }
     ch::signed_transaction transfer_non_fungible_token_data(const std::string& account, ch::non_fungible_token_data_id_type nft_data_id, const std::string& memo, bool broadcast)
-        { return exec(&wa::wallet_api::transfer_non_fungible_token_data, account, nft_data_id, memo, broadcast).wait(); }
+        { return exec("transfer_non_fungible_token_data", &wa::wallet_api::transfer_non_fungible_token_data, account, nft_data_id, memo, broadcast).wait(); }
     ch::signed_transaction burn_non_fungible_token_data(ch::non_fungible_token_data_id_type nft_data_id, bool broadcast)
-        { return exec(&wa::wallet_api::burn_non_fungible_token_data, nft_data_id, broadcast).wait(); }
+        { return exec("burn_non_fungible_token_data", &wa::wallet_api::burn_non_fungible_token_data, nft_data_id, broadcast).wait(); }
     ch::signed_transaction update_non_fungible_token_data(const std::string& modifier, ch::non_fungible_token_data_id_type nft_data_id, const bp::list& data, bool broadcast)
-        { return exec(&wa::wallet_api::update_non_fungible_token_data, modifier, nft_data_id, vector_from_list<std::pair<std::string, fc::variant>>(data), broadcast).wait(); }
+        { return exec("update_non_fungible_token_data", &wa::wallet_api::update_non_fungible_token_data, modifier, nft_data_id, vector_from_list<std::pair<std::string, fc::variant>>(data), broadcast).wait(); }
 
     // network broadcast
-    void broadcast_transaction(const ch::signed_transaction& trx) { broadcast(&wa::net_api::broadcast_transaction, trx).wait(); }
-    void broadcast_block(const ch::signed_block& block) { broadcast(&wa::net_api::broadcast_block, block).wait(); }
+    void broadcast_transaction(const ch::signed_transaction& trx) { broadcast("broadcast_transaction", &wa::net_api::broadcast_transaction, trx).wait(); }
+    void broadcast_block(const ch::signed_block& block) { broadcast("broadcast_block", &wa::net_api::broadcast_block, block).wait(); }
+
+    // block notifications, the subscription lasts as long as the returned object
+    void enable_block_callback()
+    {
+        if(m_block_callback.exchange(true))
+            return;
+
+        try {
+            auto subscribers = m_block_subscribers;
+            query("set_block_applied_callback", &wa::db_api::set_block_applied_callback,
+                  std::function<void(const fc::variant&)>([subscribers](const fc::variant &block_id) { subscribers->notify(block_id); })).wait();
+        }
+        catch(...) {
+            m_block_callback = false;
+            throw;
+        }
+    }
+
+    std::shared_ptr<Subscription> subscribe(Subscription::kind k, const bp::object &callback, uint32_t max_queue, bool coalesce)
+    {
+        enable_block_callback();
+        return std::shared_ptr<Subscription>(new Subscription(*this, m_block_subscribers, k, callback, max_queue, coalesce), Subscription::release);
+    }
+
+    std::shared_ptr<Subscription> subscribe_blocks(const bp::object &callback, uint32_t max_queue, bool coalesce)
+        { return subscribe(Subscription::blocks, callback, max_queue, coalesce); }
+    std::shared_ptr<Subscription> subscribe_irreversible(const bp::object &callback, uint32_t max_queue, bool coalesce)
+        { return subscribe(Subscription::irreversible, callback, max_queue, coalesce); }
+
+    // asynchronous queries returning asyncio futures
+    bp::object about_async() { return query("about", &wa::db_api::about).async(as_object()); }
+    bp::object get_configuration_async() { return query("get_configuration", &wa::db_api::get_configuration).async(as_object()); }
+    bp::object get_chain_properties_async() { return query("get_chain_properties", &wa::db_api::get_chain_properties).async(as_object()); }
+    bp::object get_global_properties_async() { return query("get_global_properties", &wa::db_api::get_global_properties).async(as_object()); }
+    bp::object get_dynamic_global_properties_async() { return query("get_dynamic_global_properties", &wa::db_api::get_dynamic_global_properties).async(as_object()); }
+    bp::object get_block_async(uint32_t num) { return query("get_block", &wa::db_api::get_block, num).async(as_optional()); }
+    bp::object head_block_time_async() { return query("head_block_time", &wa::db_api::head_block_time).async(as_object()); }
+    bp::object get_real_supply_async() { return query("get_real_supply", &wa::db_api::get_real_supply).async(as_object()); }
+    bp::object get_new_asset_per_block_async() { return query("get_new_asset_per_block", &wa::db_api::get_new_asset_per_block).async(as_safe_value()); }
+    bp::object get_new_asset_by_block_async(uint32_t block_num) { return query("get_asset_per_block_by_block_num", &wa::db_api::get_asset_per_block_by_block_num, block_num).async(as_safe_value()); }
+    bp::object get_miner_pay_async(fc::time_point_sec block_time) { return query("get_miner_pay_from_fees_by_block_time", &wa::db_api::get_miner_pay_from_fees_by_block_time, block_time).async(as_safe_value()); }
+    bp::object get_account_count_async() { return query("get_account_count", &wa::db_api::get_account_count).async(as_object()); }
+    bp::object get_account_async(const std::string& name) { return query("get_account_by_name", &wa::db_api::get_account_by_name, name).async(as_optional()); }
+    bp::object lookup_accounts_async(const std::string& lowerbound, uint32_t limit) { return query("lookup_accounts", &wa::db_api::lookup_accounts, lowerbound, limit).async(as_dict()); }
+    bp::object search_accounts_async(const std::string& term, const std::string& order, graphene::db::object_id_type id, uint32_t limit)
+        { return query("search_accounts", &wa::db_api::search_accounts, term, order, id, limit).async(as_list()); }
+    bp::object get_accounts_async(const bp::list& ids) { return query("get_accounts", &wa::db_api::get_accounts, vector_from_list<ch::account_id_type>(ids)).async(as_optional_list()); }
+    bp::object list_assets_async(const std::string& lowerbound, uint32_t limit) { return query("list_assets", &wa::db_api::list_assets, lowerbound, limit).async(as_list()); }
+    bp::object get_assets_async(const bp::list& ids) { return query("get_assets", &wa::db_api::get_assets, vector_from_list<ch::asset_id_type>(ids)).async(as_optional_list()); }
+    bp::object get_miner_count_async() { return query("get_miner_count", &wa::db_api::get_miner_count).async(as_object()); }
+    bp::object list_miners_async(const std::string& lowerbound, uint32_t limit) { return query("lookup_miner_accounts", &wa::db_api::lookup_miner_accounts, lowerbound, limit).async(as_dict()); }
+    bp::object get_miners_async(const bp::list& ids) { return query("get_miners", &wa::db_api::get_miners, vector_from_list<ch::miner_id_type>(ids)).async(as_optional_list()); }
+    bp::object get_miner_by_account_async(ch::account_id_type id) { return query("get_miner_by_account", &wa::db_api::get_miner_by_account, id).async(as_optional()); }
+    bp::object get_vesting_balances_async(ch::account_id_type id) { return query("get_vesting_balances", &wa::db_api::get_vesting_balances, id).async(as_list()); }
+    bp::object list_votes_async(const bp::list& ids) { return query("lookup_vote_ids", &wa::db_api::lookup_vote_ids, vector_from_list<ch::vote_id_type>(ids)).async(as_optional_list()); }
+    bp::object get_actual_votes_async() { return query("get_actual_votes", &wa::db_api::get_actual_votes).async(as_list()); }
+    bp::object search_miner_voting_async(const std::string& account, const std::string& term, bool only_my_votes, const std::string& order, const std::string& id, uint32_t limit)
+        { return query("search_miner_voting", &wa::db_api::search_miner_voting, account, term, only_my_votes, order, id, limit).async(as_list()); }
+    bp::object list_non_fungible_tokens_async(const std::string& lowerbound, uint32_t limit) { return query("list_non_fungible_tokens", &wa::db_api::list_non_fungible_tokens, lowerbound, limit).async(as_list()); }
+    bp::object get_non_fungible_tokens_async(const bp::list& ids)
+        { return query("get_non_fungible_tokens", &wa::db_api::get_non_fungible_tokens, vector_from_list<ch::non_fungible_token_id_type>(ids)).async(as_optional_list()); }
+    bp::object list_non_fungible_token_data_async(ch::non_fungible_token_id_type nft) { return query("list_non_fungible_token_data", &wa::db_api::list_non_fungible_token_data, nft).async(as_list()); }
+    bp::object get_non_fungible_token_summary_async(ch::account_id_type account) { return query("get_non_fungible_token_summary", &wa::db_api::get_non_fungible_token_summary, account).async(as_dict()); }
+    bp::object broadcast_transaction_async(const ch::signed_transaction& trx) { return broadcast("broadcast_transaction", &wa::net_api::broadcast_transaction, trx).async(as_object()); }
+
+    // Object cache, the chain properties never change and are kept for good. Accounts are kept
+    // by id and by name, a lookup either way fills both. Entries expire after their time to
+    // live and, with per_head, on every new head block, which needs the block callback that is
+    // registered here for it.
+    void enable_cache(double account_ttl, double asset_ttl, double global_properties_ttl, bool per_head)
+    {
+        if(per_head)
+            enable_block_callback();
+
+        m_accounts.configure(account_ttl, per_head);
+        m_account_names.configure(account_ttl, per_head);
+        m_assets.configure(asset_ttl, per_head);
+        m_global_properties.configure(global_properties_ttl, per_head);
+        m_chain_properties.configure(std::numeric_limits<double>::infinity(), false);
+    }
+
+    void disable_cache()
+    {
+        m_accounts.configure(0, true);
+        m_account_names.configure(0, true);
+        m_assets.configure(0, true);
+        m_global_properties.configure(0, true);
+        m_chain_properties.configure(0, true);
+    }
+
+    void clear_cache()
+    {
+        m_accounts.clear();
+        m_account_names.clear();
+        m_assets.clear();
+        m_global_properties.clear();
+        m_chain_properties.clear();
+    }
+
+    bp::dict cache_stats() const
+    {
+        bp::dict result;
+        result["accounts"] = m_accounts.stats();
+        result["account_names"] = m_account_names.stats();
+        result["assets"] = m_assets.stats();
+        result["global_properties"] = m_global_properties.stats();
+        result["chain_properties"] = m_chain_properties.stats();
+        return result;
+    }
+
+private:
+    template<typename K, typename T, typename Fetch>
+    T cached(object_cache<K, T> &cache, const K &key, Fetch fetch)
+    {
+        T value;
+        uint32_t head = m_block_subscribers->head();
+        if(!cache.get(key, head, value)) {
+            value = fetch(head);
+            cache.put(key, head, value);
+        }
+        return value;
+    }
+
+    // only the objects missing in the cache are queried
+    template<typename K, typename T, typename Method>
+    std::vector<fc::optional<T>> cached(object_cache<K, fc::optional<T>> &cache, const std::vector<K> &ids, const char *name, Method method)
+        { return cached(cache, ids, name, method, [](uint32_t, const fc::optional<T>&) {}); }
+
+    // same as above, on_fetch is called for each object found by the query
+    template<typename K, typename T, typename Method, typename OnFetch>
+    std::vector<fc::optional<T>> cached(object_cache<K, fc::optional<T>> &cache, const std::vector<K> &ids, const char *name, Method method, OnFetch on_fetch)
+    {
+        uint32_t head = m_block_subscribers->head();
+        std::vector<fc::optional<T>> result(ids.size());
+        std::vector<K> missing;
+        std::vector<size_t> index;
+        for(size_t i = 0; i < ids.size(); ++i) {
+            if(!cache.get(ids[i], head, result[i])) {
+                missing.push_back(ids[i]);
+                index.push_back(i);
+            }
+        }
+
+        if(!missing.empty()) {
+            auto fetched = query(name, method, missing).wait();
+            for(size_t i = 0; i < fetched.size() && i < index.size(); ++i) {
+                cache.put(missing[i], head, fetched[i]);
+                if(fetched[i])
+                    on_fetch(head, fetched[i]);
+                result[index[i]] = fetched[i];
+            }
+        }
+
+        return result;
+    }
+
+    template<typename T, typename Send>
+    fc::future<T> dispatch(const std::string &key, bool keyed, Send send)
+    {
+        if(keyed) {
+            if(auto replay = std::atomic_load(&m_replay))
+                return replay->template reply<T>(key);
+        }
+
+        fc::future<T> f = send();
+        if(keyed) {
+            if(auto recorder = std::atomic_load(&m_recorder))
+                return recorder->record(key, std::move(f));
+        }
+
+        return f;
+    }
+
+    template<typename T, typename Send>
+    fc::future<T> coalesced(rpc_record &r, const std::string &key, Send send)
+    {
+        std::unique_lock<std::mutex> lock(m_inflight_mutex);
+        auto it = m_inflight.find(key);
+        if(it != m_inflight.end()) {
+            typename fc::promise<T>::ptr p(new fc::promise<T>("dcore::coalesced"));
+            static_cast<inflight_waiters<T>&>(*it->second).waiters.push_back(p);
+            r.local().coalesced.fetch_add(1, std::memory_order_relaxed);
+            return fc::future<T>(p);
+        }
+
+        // sent under the lock, so a failure to send leaves no entry behind
+        fc::future<T> f = send();
+        auto entry = std::make_shared<inflight_waiters<T>>();
+        m_inflight.emplace(key, entry);
+        lock.unlock();
+
+        return observe(std::move(f), [this, key, entry](const fc::exception_ptr &e, const auto&... result) {
+            std::vector<typename fc::promise<T>::ptr> waiters;
+            {
+                std::lock_guard<std::mutex> lock(m_inflight_mutex);
+                m_inflight.erase(key);
+                waiters.swap(entry->waiters);
+            }
+
+            for(const auto &p : waiters) {
+                if(e)
+                    p->set_exception(e);
+                else
+                    p->set_value(result...);
+            }
+        });
+    }
+
+    // unhealthy connections are skipped as long as there is a healthy one
+    pool_connection& select(const connection_pool &pool)
+    {
+        const auto &connections = pool.connections;
+        size_t start = m_next_connection++;
+        pool_connection *best = nullptr;
+        for(size_t i = 0; i < connections.size(); ++i) {
+            pool_connection *c = connections[(start + i) % connections.size()].get();
+            if(!c->healthy())
+                continue;
+            if(!pool.least_outstanding)
+                return *c;
+            if(!best || c->outstanding() < best->outstanding())
+                best = c;
+        }
+
+        return best ? *best : *connections.front();
+    }
+
+    std::shared_ptr<block_subscribers> m_block_subscribers = std::make_shared<block_subscribers>();
+    std::atomic<bool> m_block_callback { false };
+
+    // published with atomic_store, the queries in flight keep using the pool they loaded
+    std::shared_ptr<const connection_pool> m_pool;
+    std::atomic<size_t> m_next_connection { 0 };
+
+    rpc_stats m_stats;
+
+    std::shared_ptr<rpc_recorder> m_recorder;
+    std::shared_ptr<rpc_replay> m_replay;
+
+    std::atomic<int64_t> m_timeout_us { 0 };
+    std::atomic<bool> m_coalesce { false };
+    std::mutex m_inflight_mutex;
+    std::unordered_map<std::string, std::shared_ptr<inflight_query>> m_inflight;
+
+    object_cache<ch::account_id_type, fc::optional<ch::account_object>> m_accounts;
+    object_cache<std::string, fc::optional<ch::account_object>> m_account_names;
+    object_cache<ch::asset_id_type, fc::optional<ch::asset_object>> m_assets;
+    object_cache<int, ch::global_property_object> m_global_properties;
+    object_cache<int, ch::chain_property_object> m_chain_properties;
+};
+
+void stop_iteration()
+{
+    PyErr_SetNone(PyExc_StopIteration);
+    bp::throw_error_already_set();
+}
+
+// Keeps up to window get_block requests in flight, a new one is issued only
+// when a block is consumed so the memory stays bounded by the window.
+class BlockIterator
+{
+public:
+    BlockIterator(Wallet &wallet, uint32_t start, uint32_t stop, uint32_t window)
+        : m_wallet(wallet), m_next(start), m_stop(stop), m_window(std::max(window, 1u)) {}
+
+    bp::object next()
+    {
+        bp::object block = fetch();
+        if(block.is_none())
+            stop_iteration();
+        return block;
+    }
+
+    // returns None past the last block
+    bp::object fetch()
+    {
+        fill();
+        if(m_pending.empty())
+            return bp::object();
+
+        // popped first, so a failed request does not fail every later call too
+        auto request = std::move(m_pending.front());
+        m_pending.pop_front();
+        auto block = request.wait();
+        if(!block.valid()) {
+            // past the head block
+            m_pending.clear();
+            m_stop = m_next;
+            return bp::object();
+        }
+
+        fill();
+        return bp::object(*block);
+    }
+
+private:
+    void fill()
+    {
+        while(m_pending.size() < m_window && (m_stop == 0 || m_next < m_stop))
+            m_pending.push_back(m_wallet.query("get_block", &wa::db_api::get_block, m_next++));
+    }
+
+    Wallet &m_wallet;
+    uint32_t m_next;
+    uint32_t m_stop;
+    uint32_t m_window;
+    std::deque<pending<fc::optional<ch::signed_block_with_info>>> m_pending;
+};
+
+BlockIterator* iter_blocks(Wallet &wallet, uint32_t start, uint32_t stop, uint32_t window)
+{
+    return new BlockIterator(wallet, start, stop, window);
+}
+
+bp::list get_blocks(Wallet &wallet, uint32_t start, uint32_t count, uint32_t window)
+{
+    bp::list l;
+    if(count == 0)
+        return l;
+
+    // the stop is exclusive, a range reaching past the last block number is cut at it
+    uint32_t stop = count > std::numeric_limits<uint32_t>::max() - start ? std::numeric_limits<uint32_t>::max() : start + count;
+    BlockIterator it(wallet, start, stop, window);
+    for(bp::object block = it.fetch(); !block.is_none(); block = it.fetch())
+        l.append(block);
+    return l;
+}
+
+inline const std::string& page_key(const std::pair<const std::string, ch::account_id_type> &entry) { return entry.first; }
+inline const std::string& page_key(const std::pair<const std::string, ch::miner_id_type> &entry) { return entry.first; }
+inline const std::string& page_key(const ch::asset_object &asset) { return asset.symbol; }
+inline const std::string& page_key(const ch::non_fungible_token_object &nft) { return nft.symbol; }
+
+template<typename T>
+bp::object page_item(const std::pair<const std::string, T> &entry) { return bp::make_tuple(entry.first, entry.second); }
+template<typename T>
+bp::object page_item(const T &object) { return bp::object(object); }
+
+// Walks a listing page by page, the next page is queried while the current one is
+// consumed and entries are converted only when returned. Pages start at the key of the
+// previous page's last entry, so the first entry of every following page is skipped.
+template<typename Page>
+class PageIterator
+{
+public:
+    typedef Page (wa::db_api::*method_type)(const std::string&, uint32_t) const;
+
+    PageIterator(Wallet &wallet, const char *name, method_type method, const std::string &lowerbound, uint32_t page_size)
+        : m_wallet(wallet), m_name(name), m_method(method), m_page_size(std::max(page_size, 2u)), m_pos(m_page.end())
+    {
+        request(lowerbound);
+    }
+
+    bp::object next()
+    {
+        while(m_pos == m_page.end()) {
+            if(!load())
+                stop_iteration();
+        }
+
+        return page_item(*m_pos++);
+    }
+
+private:
+    void request(const std::string &lowerbound)
+    {
+        m_pending.reset(new pending<Page>(m_wallet.query(m_name, m_method, lowerbound, m_page_size)));
+    }
+
+    bool load()
+    {
+        if(!m_pending)
+            return false;
+
+        m_page = m_pending->wait();
+        m_pending.reset();
+        m_pos = m_page.begin();
+        if(m_page.empty())
+            return true;
+
+        if(!m_last_key.empty() && page_key(*m_pos) == m_last_key)
+            ++m_pos;
+
+        m_last_key = page_key(*m_page.rbegin());
+        if(m_page.size() == m_page_size)
+            request(m_last_key);
+        return true;
+    }
+
+    Wallet &m_wallet;
+    const char *m_name;
+    method_type m_method;
+    uint32_t m_page_size;
+    Page m_page;
+    typename Page::const_iterator m_pos;
+    std::string m_last_key;
+    std::unique_ptr<pending<Page>> m_pending;
+};
+
+typedef PageIterator<std::map<std::string, ch::account_id_type>> AccountIterator;
+typedef PageIterator<std::vector<ch::asset_object>> AssetIterator;
+typedef PageIterator<std::map<std::string, ch::miner_id_type>> MinerIterator;
+typedef PageIterator<std::vector<ch::non_fungible_token_object>> NonFungibleTokenIterator;
+
+AccountIterator* iter_accounts(Wallet &wallet, const std::string &lowerbound, uint32_t page_size)
+{
+    return new AccountIterator(wallet, "lookup_accounts", &wa::db_api::lookup_accounts, lowerbound, page_size);
+}
+
+AssetIterator* iter_assets(Wallet &wallet, const std::string &lowerbound, uint32_t page_size)
+{
+    return new AssetIterator(wallet, "list_assets", &wa::db_api::list_assets, lowerbound, page_size);
+}
+
+MinerIterator* iter_miners(Wallet &wallet, const std::string &lowerbound, uint32_t page_size)
+{
+    return new MinerIterator(wallet, "lookup_miner_accounts", &wa::db_api::lookup_miner_accounts, lowerbound, page_size);
+}
+
+NonFungibleTokenIterator* iter_non_fungible_tokens(Wallet &wallet, const std::string &lowerbound, uint32_t page_size)
+{
+    return new NonFungibleTokenIterator(wallet, "list_non_fungible_tokens", &wa::db_api::list_non_fungible_tokens, lowerbound, page_size);
+}
+
+// Pipelines transaction broadcasts with at most max_in_flight requests outstanding, the
+// submitting thread blocks while the queue is full. Transactions rejected for an expired
+// or unknown reference block are stamped and signed by the wallet again and resent, which
+// only works for transactions signed by keys imported in the wallet.
+class BroadcastQueue
+{
+public:
+    BroadcastQueue(Wallet &wallet, uint32_t max_in_flight, uint32_t retries)
+        : m_wallet(wallet), m_max_in_flight(std::max(max_in_flight, 1u)), m_retries(retries) {}
+
+    ~BroadcastQueue()
+    {
+        // completion handlers refer to this queue
+        gil_release nogil;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return m_in_flight == 0; });
+    }
+
+    size_t submit(const ch::signed_transaction &trx)
+    {
+        gil_release nogil;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(m_trxs.empty())
+            m_start = std::chrono::steady_clock::now();
+
+        size_t index = m_trxs.size();
+        m_trxs.push_back({ trx, nullptr, 0, false });
+        m_cond.wait(lock, [this]() { return m_in_flight < m_max_in_flight; });
+        send(lock, index);
+        process_retries(lock);
+        return index;
+    }
+
+    void submit_many(const bp::list &trxs)
+    {
+        for(const ch::signed_transaction &trx : vector_from_list<ch::signed_transaction>(trxs))
+            submit(trx);
+    }
+
+    // results of the transactions submitted since the previous call, None or the exception
+    bp::list wait()
+    {
+        std::vector<fc::exception_ptr> errors;
+        {
+            gil_release nogil;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(true) {
+                m_cond.wait(lock, [this]() { return m_in_flight == 0 || !m_retry.empty(); });
+                if(m_retry.empty())
+                    break;
+                process_retries(lock);
+            }
+
+            for(const auto &t : m_trxs)
+                errors.push_back(t.error);
+            m_trxs.clear();
+        }
+
+        bp::list result;
+        bp::object exception(bp::handle<>(bp::borrowed(exception_class)));
+        for(const auto &e : errors)
+            result.append(e ? exception(e->to_detail_string()) : bp::object());
+        return result;
+    }
+
+    bp::dict stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        double elapsed = std::max(std::chrono::duration<double>((m_in_flight ? std::chrono::steady_clock::now() : m_last) - m_start).count(), 0.0);
+        bp::dict result;
+        result["submitted"] = m_submitted;
+        result["succeeded"] = m_succeeded;
+        result["failed"] = m_failed;
+        result["retried"] = m_retried;
+        result["in_flight"] = m_in_flight;
+        result["elapsed"] = elapsed;
+        result["throughput"] = elapsed > 0 ? m_succeeded / elapsed : 0.0;
+        return result;
+    }
+
+private:
+    struct entry
+    {
+        ch::signed_transaction trx;
+        fc::exception_ptr error;
+        uint32_t attempts;
+        bool done;
+    };
+
+    // The node checks the expiration and reference block with plain assertions, so a failed
+    // assertion is retried only when the transaction is stale compared to the node's head.
+    static bool retriable(const fc::exception_ptr &e)
+    {
+        return e->code() == fc::assert_exception_code;
+    }
+
+    bool stale(const ch::signed_transaction &trx)
+    {
+        ch::dynamic_global_property_object dgp = m_wallet.query("get_dynamic_global_properties", &wa::db_api::get_dynamic_global_properties).wait_until();
+        if(trx.expiration <= dgp.time)
+            return true;
+
+        uint32_t num = dgp.head_block_number - ((dgp.head_block_number - trx.ref_block_num) & 0xffff);
+        if(num == dgp.head_block_number)
+            return trx.ref_block_prefix != dgp.head_block_id._hash[1];
+
+        fc::optional<ch::signed_block_with_info> block = m_wallet.query("get_block", &wa::db_api::get_block, num).wait_until();
+        return !block || trx.ref_block_prefix != block->block_id._hash[1];
+    }
+
+    // the completion handler locks the queue and runs inline for a broadcast already
+    // complete, so the lock is released while sending
+    void send(std::unique_lock<std::mutex> &lock, size_t index)
+    {
+        ++m_in_flight;
+        ++m_submitted;
+        ++m_trxs[index].attempts;
+        ch::signed_transaction trx = m_trxs[index].trx;
+
+        lock.unlock();
+        try {
+            fc::future<void> f = m_wallet.broadcast("broadcast_transaction", &wa::net_api::broadcast_transaction, trx).future();
+            when_complete(f, [this, index](const fc::exception_ptr &e) { complete(index, e); });
+        }
+        catch(const fc::exception &e) {
+            complete(index, e.dynamic_copy_exception());
+        }
+        lock.lock();
+    }
+
+    void complete(size_t index, const fc::exception_ptr &e)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_in_flight;
+            m_last = std::chrono::steady_clock::now();
+            entry &t = m_trxs[index];
+            if(e && t.attempts <= m_retries && retriable(e)) {
+                t.error = e;
+                m_retry.push_back(index);
+            }
+            else {
+                t.error = e;
+                t.done = true;
+                ++(e ? m_failed : m_succeeded);
+            }
+        }
+        m_cond.notify_all();
+    }
+
+    // signing goes through the wallet, so it is done by the submitting thread
+    void process_retries(std::unique_lock<std::mutex> &lock)
+    {
+        while(!m_retry.empty()) {
+            size_t index = m_retry.front();
+            m_retry.pop_front();
+            ch::signed_transaction trx = m_trxs[index].trx;
+            fc::exception_ptr error = m_trxs[index].error;
+
+            lock.unlock();
+            bool resign = false;
+            try {
+                resign = stale(trx);
+                if(resign) {
+                    trx.signatures.clear();
+                    trx = m_wallet.exec("sign_transaction", &wa::wallet_api::sign_transaction, trx, false).wait_until();
+                    error.reset();
+                }
+            }
+            catch(const fc::exception &e) {
+                error = e.dynamic_copy_exception();
+            }
+            lock.lock();
+
+            if(resign)
+                ++m_retried;
+
+            if(error) {
+                m_trxs[index].error = error;
+                m_trxs[index].done = true;
+                ++m_failed;
+                continue;
+            }
+
+            m_trxs[index].trx = trx;
+            m_trxs[index].error.reset();
+            m_cond.wait(lock, [this]() { return m_in_flight < m_max_in_flight; });
+            send(lock, index);
+        }
+    }
+
+    Wallet &m_wallet;
+    uint32_t m_max_in_flight;
+    uint32_t m_retries;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<entry> m_trxs;
+    std::deque<size_t> m_retry;
+    uint32_t m_in_flight = 0;
+    uint64_t m_submitted = 0;
+    uint64_t m_succeeded = 0;
+    uint64_t m_failed = 0;
+    uint64_t m_retried = 0;
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::steady_clock::time_point m_last;
+};
+
+BroadcastQueue* broadcast_queue(Wallet &wallet, uint32_t max_in_flight, uint32_t retries)
+{
+    return new BroadcastQueue(wallet, max_in_flight, retries);
+}
+
+bp::list broadcast_transactions(Wallet &wallet, const bp::list &trxs, uint32_t max_in_flight, uint32_t retries)
+{
+    BroadcastQueue queue(wallet, max_in_flight, retries);
+    queue.submit_many(trxs);
+    return queue.wait();
+}
+
+// Keeps the reference block and chain time up to date on a background thread, so stamping
+// transactions needs no request. The last irreversible block is referenced by default since
+// a fork cannot drop it, the head block is fresher but its transactions die with the fork.
+class ReferenceBlockProvider
+{
+public:
+    ReferenceBlockProvider(Wallet &wallet, double refresh, uint32_t expiration, bool irreversible)
+        : m_wallet(wallet), m_refresh(std::max(refresh, 0.01)), m_expiration(expiration), m_irreversible(irreversible)
+    {
+        {
+            gil_release nogil;
+            update();
+        }
+        m_thread = std::thread(&ReferenceBlockProvider::run, this);
+    }
+
+    // a refresh in flight notices m_stopped within poll_interval, so the join is bounded
+    ~ReferenceBlockProvider()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+        m_cond.notify_all();
+
+        gil_release nogil;
+        m_thread.join();
+    }
+
+    // sets the reference block and expiration, done before signing
+    void stamp(const bp::object &trx) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ch::transaction &t = bp::extract<ch::transaction&>(trx);
+            t.set_reference_block(m_block_id);
+            t.expiration = expiration(std::chrono::steady_clock::now());
+        }
+        invalidate_digests(trx);
+    }
+
+    void stamp_all(const bp::list &trxs) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        fc::time_point_sec exp = expiration(std::chrono::steady_clock::now());
+        for(bp::ssize_t i = 0; i < bp::len(trxs); ++i) {
+            ch::transaction &trx = bp::extract<ch::transaction&>(trxs[i]);
+            trx.set_reference_block(m_block_id);
+            trx.expiration = exp;
+            invalidate_digests(trxs[i]);
+        }
+    }
+
+    void refresh()
+    {
+        gil_release nogil;
+        update();
+    }
+
+    uint32_t block_num() const { std::lock_guard<std::mutex> lock(m_mutex); return ch::block_header::num_from_id(m_block_id); }
+    ch::block_id_type block_id() const { std::lock_guard<std::mutex> lock(m_mutex); return m_block_id; }
+    uint64_t refreshes() const { std::lock_guard<std::mutex> lock(m_mutex); return m_refreshes; }
+    uint64_t errors() const { std::lock_guard<std::mutex> lock(m_mutex); return m_errors; }
+
+private:
+    // chain time advanced by the local clock since the last refresh
+    fc::time_point_sec expiration(std::chrono::steady_clock::time_point now) const
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_updated).count();
+        return m_time + static_cast<uint32_t>(elapsed + m_expiration);
+    }
+
+    // A refresh gives up after refresh_timeout, a stalled node must not keep the previous
+    // reference forever nor the destructor waiting; the stop flag is polled meanwhile.
+    template<typename T>
+    T wait(pending<T> request, fc::time_point deadline)
+    {
+        while(true) {
+            try {
+                return request.wait_until(std::min(deadline, fc::time_point::now() + poll_interval));
+            }
+            catch(const fc::timeout_exception&) {
+                if(m_stopped || fc::time_point::now() >= deadline) {
+                    request.future().cancel();
+                    throw;
+                }
+            }
+        }
+    }
+
+    void update()
+    {
+        fc::time_point deadline = fc::time_point::now() + refresh_timeout;
+        ch::dynamic_global_property_object dgp = wait(m_wallet.query("get_dynamic_global_properties", &wa::db_api::get_dynamic_global_properties), deadline);
+        ch::block_id_type block_id = dgp.head_block_id;
+        if(m_irreversible && dgp.last_irreversible_block_num > 0) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if(ch::block_header::num_from_id(m_block_id) == dgp.last_irreversible_block_num) {
+                block_id = m_block_id;
+            }
+            else {
+                lock.unlock();
+                auto block = wait(m_wallet.query("get_block", &wa::db_api::get_block, dgp.last_irreversible_block_num), deadline);
+                if(block)
+                    block_id = block->block_id;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_block_id = block_id;
+        m_time = dgp.time;
+        m_updated = std::chrono::steady_clock::now();
+        ++m_refreshes;
+    }
+
+    // this thread never holds the GIL, a failed refresh keeps the previous reference
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(!m_cond.wait_for(lock, m_refresh, [this]() { return m_stopped.load(); })) {
+            lock.unlock();
+            try {
+                update();
+            }
+            catch(const fc::exception&) {
+                std::lock_guard<std::mutex> error_lock(m_mutex);
+                ++m_errors;
+            }
+            lock.lock();
+        }
+    }
+
+    Wallet &m_wallet;
+    std::chrono::duration<double> m_refresh;
+    uint32_t m_expiration;
+    bool m_irreversible;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    ch::block_id_type m_block_id;
+    fc::time_point_sec m_time;
+    std::chrono::steady_clock::time_point m_updated;
+    uint64_t m_refreshes = 0;
+    uint64_t m_errors = 0;
+    std::atomic<bool> m_stopped { false };
+    std::thread m_thread;
+
+    static const fc::microseconds refresh_timeout;
+    static const fc::microseconds poll_interval;
 };
 
+const fc::microseconds ReferenceBlockProvider::refresh_timeout = fc::seconds(10);
+const fc::microseconds ReferenceBlockProvider::poll_interval = fc::milliseconds(100);
+
+ReferenceBlockProvider* reference_block_provider(Wallet &wallet, double refresh, uint32_t expiration, bool irreversible)
+{
+    return new ReferenceBlockProvider(wallet, refresh, expiration, irreversible);
+}
+
 } // dcore
 
 #if defined(__GNUC__) && __GNUC__ <= 7 && __GNUC_MINOR__ <= 4
@@ -319,12 +2446,79 @@ BOOST_PYTHON_MODULE(dcore)
         .def_readonly("pretty_amount", &wa::extended_asset::pretty_amount)
     ;
 
+    bp::class_<dcore::Deadline, boost::noncopyable>("Deadline", bp::init<double>((bp::arg("seconds"))))
+        .add_property("remaining", &dcore::Deadline::remaining)
+        .def("__enter__", &dcore::Deadline::enter, bp::return_self<>())
+        .def("__exit__", &dcore::Deadline::exit)
+    ;
+
+    bp::class_<dcore::BlockIterator, boost::noncopyable>("BlockIterator", bp::no_init)
+        .def("__iter__", bp::objects::identity_function())
+        .def("__next__", &dcore::BlockIterator::next)
+    ;
+
+    bp::class_<dcore::AccountIterator, boost::noncopyable>("AccountIterator", bp::no_init)
+        .def("__iter__", bp::objects::identity_function())
+        .def("__next__", &dcore::AccountIterator::next)
+    ;
+
+    bp::class_<dcore::AssetIterator, boost::noncopyable>("AssetIterator", bp::no_init)
+        .def("__iter__", bp::objects::identity_function())
+        .def("__next__", &dcore::AssetIterator::next)
+    ;
+
+    bp::class_<dcore::MinerIterator, boost::noncopyable>("MinerIterator", bp::no_init)
+        .def("__iter__", bp::objects::identity_function())
+        .def("__next__", &dcore::MinerIterator::next)
+    ;
+
+    bp::class_<dcore::NonFungibleTokenIterator, boost::noncopyable>("NonFungibleTokenIterator", bp::no_init)
+        .def("__iter__", bp::objects::identity_function())
+        .def("__next__", &dcore::NonFungibleTokenIterator::next)
+    ;
+
+    bp::class_<dcore::BroadcastQueue, boost::noncopyable>("BroadcastQueue", bp::no_init)
+        .def("submit", &dcore::BroadcastQueue::submit, (bp::arg("trx")))
+        .def("submit_many", &dcore::BroadcastQueue::submit_many, (bp::arg("trxs")))
+        .def("wait", &dcore::BroadcastQueue::wait)
+        .def("stats", &dcore::BroadcastQueue::stats)
+    ;
+
+    bp::class_<dcore::ReferenceBlockProvider, boost::noncopyable>("ReferenceBlockProvider", bp::no_init)
+        .add_property("block_num", &dcore::ReferenceBlockProvider::block_num)
+        .add_property("block_id", &dcore::ReferenceBlockProvider::block_id)
+        .add_property("refreshes", &dcore::ReferenceBlockProvider::refreshes)
+        .add_property("errors", &dcore::ReferenceBlockProvider::errors)
+        .def("stamp", &dcore::ReferenceBlockProvider::stamp, (bp::arg("trx")))
+        .def("stamp_all", &dcore::ReferenceBlockProvider::stamp_all, (bp::arg("trxs")))
+        .def("refresh", &dcore::ReferenceBlockProvider::refresh)
+    ;
+
+    bp::class_<dcore::Subscription, std::shared_ptr<dcore::Subscription>, boost::noncopyable>("Subscription", bp::no_init)
+        .add_property("active", &dcore::Subscription::active)
+        .add_property("dropped", &dcore::Subscription::dropped)
+        .add_property("queued", &dcore::Subscription::queued)
+        .def("cancel", &dcore::Subscription::cancel)
+    ;
+
     bp::class_<dcore::Wallet, boost::noncopyable>("Wallet", bp::init<>())
         .def("__bool__", &dcore::Wallet::is_new)
         .add_property("locked", &dcore::Wallet::is_locked)
         .add_property("connected", &dcore::Wallet::is_connected)
         .add_property("filename", &dcore::Wallet::get_filename)
         .def("connect", &dcore::Wallet::connect, (bp::arg("wallet_file"), bp::arg("server") = "", bp::arg("user") = "", bp::arg("password") = ""))
+        .def("connect_pool", &dcore::Wallet::connect_pool, (bp::arg("wallet_file"), bp::arg("servers"), bp::arg("connections") = 4, bp::arg("user") = "",
+            bp::arg("password") = "", bp::arg("strategy") = "least_outstanding"))
+        .def("pool_status", &dcore::Wallet::pool_status)
+        .add_property("timeout", &dcore::Wallet::get_timeout, &dcore::Wallet::set_timeout)
+        .add_property("coalesce", &dcore::Wallet::get_coalesce, &dcore::Wallet::set_coalesce)
+        .def("start_recording", &dcore::Wallet::start_recording, (bp::arg("path")))
+        .def("stop_recording", &dcore::Wallet::stop_recording)
+        .def("replay", &dcore::Wallet::replay, (bp::arg("path"), bp::arg("latency") = 0.0, bp::arg("recorded_latency") = false))
+        .def("stop_replay", &dcore::Wallet::stop_replay)
+        .def("stats", &dcore::Wallet::stats)
+        .def("reset_stats", &dcore::Wallet::reset_stats)
+        .def("stats_prometheus", &dcore::Wallet::stats_prometheus)
         .def("lock", &dcore::Wallet::lock)
         .def("unlock", &dcore::Wallet::unlock, (bp::arg("password")))
         .def("set_password", &dcore::Wallet::set_password, (bp::arg("password")))
@@ -342,6 +2536,9 @@ BOOST_PYTHON_MODULE(dcore)
         .def("get_global_properties", &dcore::Wallet::get_global_properties)
         .def("get_dynamic_global_properties", &dcore::Wallet::get_dynamic_global_properties)
         .def("get_block", &dcore::Wallet::get_block, (bp::arg("num")))
+        .def("get_blocks", dcore::get_blocks, (bp::arg("start"), bp::arg("count"), bp::arg("window") = 64))
+        .def("iter_blocks", dcore::iter_blocks, (bp::arg("start"), bp::arg("stop") = 0, bp::arg("window") = 64),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
         .def("head_block_time", &dcore::Wallet::head_block_time)
         .def("get_real_supply", &dcore::Wallet::get_real_supply)
         .def("get_new_asset_per_block", &dcore::Wallet::get_new_asset_per_block)
@@ -350,6 +2547,8 @@ BOOST_PYTHON_MODULE(dcore)
         .def("get_account_count", &dcore::Wallet::get_account_count)
         .def("get_account", &dcore::Wallet::get_account, (bp::arg("name")))
         .def("lookup_accounts", &dcore::Wallet::lookup_accounts, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("iter_accounts", dcore::iter_accounts, (bp::arg("lowerbound") = "", bp::arg("page_size") = 100),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
         .def("search_accounts", &dcore::Wallet::search_accounts, (bp::arg("term"), bp::arg("order"), bp::arg("id"), bp::arg("limit")))
         .def("list_account_balances", &dcore::Wallet::list_account_balances, (bp::arg("account")))
         .def("get_accounts", &dcore::Wallet::get_accounts, (bp::arg("ids")))
@@ -366,6 +2565,8 @@ BOOST_PYTHON_MODULE(dcore)
         .def("transfer", &dcore::Wallet::transfer,
             (bp::arg("from"), bp::arg("to"), bp::arg("amount"), bp::arg("symbol"), bp::arg("memo"), bp::arg("broadcast") = false))
         .def("list_assets", &dcore::Wallet::list_assets, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("iter_assets", dcore::iter_assets, (bp::arg("lowerbound") = "", bp::arg("page_size") = 100),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
         .def("get_assets", &dcore::Wallet::get_assets, (bp::arg("ids")))
         .def("create_monitored_asset", &dcore::Wallet::create_monitored_asset,
             (bp::arg("issuer"), bp::arg("symbol"), bp::arg("precision"), bp::arg("description"), bp::arg("feed_lifetime_sec"), bp::arg("minimum_feeds"), bp::arg("broadcast") = false))
@@ -388,6 +2589,8 @@ BOOST_PYTHON_MODULE(dcore)
             (bp::arg("account"), bp::arg("symbol"), bp::arg("feed"), bp::arg("broadcast") = false))
         .def("get_miner_count", &dcore::Wallet::get_miner_count)
         .def("list_miners", &dcore::Wallet::list_miners, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("iter_miners", dcore::iter_miners, (bp::arg("lowerbound") = "", bp::arg("page_size") = 100),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
         .def("get_miners", &dcore::Wallet::get_miners, (bp::arg("ids")))
         .def("get_miner_by_account", &dcore::Wallet::get_miner_by_account, (bp::arg("id")))
         .def("get_vesting_balances", &dcore::Wallet::get_vesting_balances, (bp::arg("id")))
@@ -401,6 +2604,8 @@ BOOST_PYTHON_MODULE(dcore)
         .def("set_voting_proxy", &dcore::Wallet::set_voting_proxy, (bp::arg("account"), bp::arg("voting_account"), bp::arg("broadcast") = false))
         .def("set_desired_miner_count", &dcore::Wallet::set_desired_miner_count, (bp::arg("account"), bp::arg("number_of_miners"), bp::arg("broadcast") = false))
         .def("list_non_fungible_tokens", &dcore::Wallet::list_non_fungible_tokens, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("iter_non_fungible_tokens", dcore::iter_non_fungible_tokens, (bp::arg("lowerbound") = "", bp::arg("page_size") = 100),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
         .def("get_non_fungible_tokens", &dcore::Wallet::get_non_fungible_tokens, (bp::arg("ids")))
         .def("list_non_fungible_token_data", &dcore::Wallet::list_non_fungible_token_data, (bp::arg("nft")))
         .def("get_non_fungible_token_summary", &dcore::Wallet::get_non_fungible_token_summary, (bp::arg("account")))
@@ -416,5 +2621,51 @@ BOOST_PYTHON_MODULE(dcore)
         .def("update_non_fungible_token_data", &dcore::Wallet::update_non_fungible_token_data, (bp::arg("modifier"), bp::arg("nft_data_id"), bp::arg("data"), bp::arg("broadcast") = false))
         .def("broadcast_transaction", &dcore::Wallet::broadcast_transaction, (bp::arg("trx")))
         .def("broadcast_block", &dcore::Wallet::broadcast_block, (bp::arg("block")))
+        .def("broadcast_transactions", dcore::broadcast_transactions, (bp::arg("trxs"), bp::arg("max_in_flight") = 64, bp::arg("retries") = 1))
+        .def("broadcast_queue", dcore::broadcast_queue, (bp::arg("max_in_flight") = 64, bp::arg("retries") = 1),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
+        .def("reference_block_provider", dcore::reference_block_provider, (bp::arg("refresh") = 1.0, bp::arg("expiration") = 60, bp::arg("irreversible") = true),
+            bp::return_value_policy<bp::manage_new_object, bp::with_custodian_and_ward_postcall<0, 1>>())
+        .def("about_async", &dcore::Wallet::about_async)
+        .def("get_configuration_async", &dcore::Wallet::get_configuration_async)
+        .def("get_chain_properties_async", &dcore::Wallet::get_chain_properties_async)
+        .def("get_global_properties_async", &dcore::Wallet::get_global_properties_async)
+        .def("get_dynamic_global_properties_async", &dcore::Wallet::get_dynamic_global_properties_async)
+        .def("get_block_async", &dcore::Wallet::get_block_async, (bp::arg("num")))
+        .def("head_block_time_async", &dcore::Wallet::head_block_time_async)
+        .def("get_real_supply_async", &dcore::Wallet::get_real_supply_async)
+        .def("get_new_asset_per_block_async", &dcore::Wallet::get_new_asset_per_block_async)
+        .def("get_new_asset_by_block_async", &dcore::Wallet::get_new_asset_by_block_async, (bp::arg("block_num")))
+        .def("get_miner_pay_async", &dcore::Wallet::get_miner_pay_async, (bp::arg("block_time")))
+        .def("get_account_count_async", &dcore::Wallet::get_account_count_async)
+        .def("get_account_async", &dcore::Wallet::get_account_async, (bp::arg("name")))
+        .def("lookup_accounts_async", &dcore::Wallet::lookup_accounts_async, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("search_accounts_async", &dcore::Wallet::search_accounts_async, (bp::arg("term"), bp::arg("order"), bp::arg("id"), bp::arg("limit")))
+        .def("get_accounts_async", &dcore::Wallet::get_accounts_async, (bp::arg("ids")))
+        .def("list_assets_async", &dcore::Wallet::list_assets_async, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("get_assets_async", &dcore::Wallet::get_assets_async, (bp::arg("ids")))
+        .def("get_miner_count_async", &dcore::Wallet::get_miner_count_async)
+        .def("list_miners_async", &dcore::Wallet::list_miners_async, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("get_miners_async", &dcore::Wallet::get_miners_async, (bp::arg("ids")))
+        .def("get_miner_by_account_async", &dcore::Wallet::get_miner_by_account_async, (bp::arg("id")))
+        .def("get_vesting_balances_async", &dcore::Wallet::get_vesting_balances_async, (bp::arg("id")))
+        .def("list_votes_async", &dcore::Wallet::list_votes_async, (bp::arg("ids")))
+        .def("get_actual_votes_async", &dcore::Wallet::get_actual_votes_async)
+        .def("search_miner_voting_async", &dcore::Wallet::search_miner_voting_async,
+            (bp::arg("account"), bp::arg("term"), bp::arg("only_my_votes"), bp::arg("order"), bp::arg("id"), bp::arg("limit")))
+        .def("list_non_fungible_tokens_async", &dcore::Wallet::list_non_fungible_tokens_async, (bp::arg("lowerbound"), bp::arg("limit")))
+        .def("get_non_fungible_tokens_async", &dcore::Wallet::get_non_fungible_tokens_async, (bp::arg("ids")))
+        .def("list_non_fungible_token_data_async", &dcore::Wallet::list_non_fungible_token_data_async, (bp::arg("nft")))
+        .def("get_non_fungible_token_summary_async", &dcore::Wallet::get_non_fungible_token_summary_async, (bp::arg("account")))
+        .def("broadcast_transaction_async", &dcore::Wallet::broadcast_transaction_async, (bp::arg("trx")))
+        .def("enable_cache", &dcore::Wallet::enable_cache, (bp::arg("account_ttl") = 10.0, bp::arg("asset_ttl") = 60.0, bp::arg("global_properties_ttl") = 60.0,
+            bp::arg("per_head_block") = true))
+        .def("disable_cache", &dcore::Wallet::disable_cache)
+        .def("clear_cache", &dcore::Wallet::clear_cache)
+        .def("cache_stats", &dcore::Wallet::cache_stats)
+        .def("subscribe_blocks", &dcore::Wallet::subscribe_blocks, (bp::arg("callback"), bp::arg("max_queue") = 1024, bp::arg("coalesce") = false),
+            bp::with_custodian_and_ward_postcall<0, 1>())
+        .def("subscribe_irreversible", &dcore::Wallet::subscribe_irreversible, (bp::arg("callback"), bp::arg("max_queue") = 1024, bp::arg("coalesce") = false),
+            bp::with_custodian_and_ward_postcall<0, 1>())
     ;
 }
@@ -1,11 +1,48 @@
 #include <boost/python.hpp>
 #include <fc/io/json.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/io/raw_variant.hpp>
 #include <graphene/db/object_id.hpp>
+#include <graphene/chain/protocol/types.hpp>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 
 namespace bp = boost::python;
 
 namespace dcore {
 
+extern PyObject *exception_class;
+extern PyObject *timeout_class;
+
+class gil_release
+{
+public:
+    gil_release() : m_state(PyEval_SaveThread()) {}
+    ~gil_release() { PyEval_RestoreThread(m_state); }
+
+    gil_release(const gil_release&) = delete;
+    gil_release& operator=(const gil_release&) = delete;
+
+private:
+    PyThreadState *m_state;
+};
+
+class gil_acquire
+{
+public:
+    gil_acquire() : m_state(PyGILState_Ensure()) {}
+    ~gil_acquire() { PyGILState_Release(m_state); }
+
+    gil_acquire(const gil_acquire&) = delete;
+    gil_acquire& operator=(const gil_acquire&) = delete;
+
+private:
+    PyGILState_STATE m_state;
+};
+
 template<typename T>
 std::size_t object_hash(const T& obj)
 {
@@ -18,12 +55,84 @@ std::string object_repr(const T& obj)
     return fc::json::to_string(obj);
 }
 
+template<typename T>
+bp::object object_to_bytes(const T& obj)
+{
+    std::vector<char> data = fc::raw::pack(obj);
+    return bp::object(bp::handle<>(PyBytes_FromStringAndSize(data.data(), data.size())));
+}
+
+// A contiguous view of a bytes-like object, released with the view.
+class buffer_view
+{
+public:
+    explicit buffer_view(const bp::object& obj)
+    {
+        if(PyObject_GetBuffer(obj.ptr(), &m_view, PyBUF_SIMPLE) != 0)
+            bp::throw_error_already_set();
+    }
+
+    ~buffer_view() { PyBuffer_Release(&m_view); }
+
+    buffer_view(const buffer_view&) = delete;
+    buffer_view& operator=(const buffer_view&) = delete;
+
+    const char* data() const { return static_cast<const char*>(m_view.buf); }
+    std::size_t size() const { return static_cast<std::size_t>(m_view.len); }
+
+private:
+    Py_buffer m_view;
+};
+
+// the whole buffer has to be consumed, trailing bytes are rejected
+template<typename T>
+T object_from_bytes(const bp::object& data)
+{
+    buffer_view view(data);
+    fc::datastream<const char*> ds(view.data(), view.size());
+    T obj;
+    fc::raw::unpack(ds, obj);
+    if(ds.remaining() != 0)
+        FC_THROW("${n} trailing bytes", ("n", ds.remaining()));
+    return obj;
+}
+
+// Adds to_bytes and the from_bytes static method, T is the class wrapped by instance unless given.
+template<typename T = void, typename C>
+C& def_bytes(C&& instance)
+{
+    typedef typename std::conditional<std::is_void<T>::value, typename std::decay<C>::type::wrapped_type, T>::type value_type;
+    instance.def("to_bytes", object_to_bytes<value_type>);
+    instance.def("from_bytes", object_from_bytes<value_type>);
+    instance.staticmethod("from_bytes");
+    return instance;
+}
+
+template<typename T>
+std::size_t object_packed_size(const T& obj)
+{
+    return fc::raw::pack_size(obj);
+}
+
 template<typename T>
 std::string object_id_str(const T& obj)
 {
     return std::string(static_cast<graphene::db::object_id_type>(obj));
 }
 
+template<typename T>
+std::vector<T> vector_from_list(const bp::list &l)
+{
+    std::vector<T> obj;
+    auto len = bp::len(l);
+    obj.resize(len);
+    while(len--) {
+        bp::extract<T> v(l[len]);
+        obj[len] = v();
+    }
+    return obj;
+}
+
 template<typename T, typename Container, const Container T::* container>
 bp::list encode_list(const T &obj)
 {
@@ -140,10 +249,54 @@ public:
         instance.def_readonly("object_id", &T::id);
         instance.def("get_id", &T::get_id);
         instance.def("__repr__", object_repr<T>);
-        return instance;
+        return def_bytes<T>(instance);
     }
 };
 
+// Calls f(i) for every index below count on up to threads native threads, one per core when
+// zero. Call it with the GIL released, the first exception thrown by f is rethrown.
+template<typename F>
+void parallel_for(std::size_t count, unsigned threads, F f)
+{
+    if(threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, count));
+
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto run = [&]() {
+        for(std::size_t i = next++; i < count; i = next++) {
+            try {
+                f(i);
+            }
+            catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error)
+                    error = std::current_exception();
+                next = count;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned i = 1; i < threads; ++i)
+        workers.emplace_back(run);
+    run();
+    for(auto &w : workers)
+        w.join();
+
+    if(error)
+        std::rethrow_exception(error);
+}
+
+// drops the cached digests of a transaction changed in place
+void invalidate_digests(const bp::object& trx);
+
+// encrypts a memo with the shared secret cached per pair of keys, from is the public key of priv
+std::vector<char> encrypt_memo(const std::string& message, const graphene::chain::private_key_type& priv,
+                               const graphene::chain::public_key_type& from, const graphene::chain::public_key_type& to, uint64_t nonce);
+
 void register_common_types();
 void register_account();
 void register_asset();
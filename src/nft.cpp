@@ -21,14 +21,14 @@ void register_nft()
     ;
 
     typedef std::pair<std::string, fc::variant> nft_data_value;
-    bp::class_<nft_data_value>("NonFungibleTokenDataValue", bp::init<>())
+    def_bytes(bp::class_<nft_data_value>("NonFungibleTokenDataValue", bp::init<>()))
         .def(bp::init<std::string, fc::variant>())
         .def("__repr__", object_repr<nft_data_value>)
         .def_readwrite("name", &nft_data_value::first)
         .def_readwrite("value", &nft_data_value::second)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_data_type>("NonFungibleTokenDataDefinition", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_data_type>("NonFungibleTokenDataDefinition", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_data_type>)
         .def_readwrite("unique", &graphene::chain::non_fungible_token_data_type::unique)
         .def_readwrite("modifiable", &graphene::chain::non_fungible_token_data_type::modifiable)
@@ -38,7 +38,7 @@ void register_nft()
             encode_optional_type<graphene::chain::non_fungible_token_data_type, std::string, &graphene::chain::non_fungible_token_data_type::name>)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_options>("NonFungibleTokenOptions", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_options>("NonFungibleTokenOptions", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_options>)
         .def_readwrite("issuer", &graphene::chain::non_fungible_token_options::issuer)
         .def_readwrite("max_supply", &graphene::chain::non_fungible_token_options::max_supply)
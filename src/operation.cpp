@@ -45,6 +45,40 @@ bp::object get_messaging_payload(const graphene::chain::custom_operation& op)
     return bp::object();
 }
 
+// Encrypts one text for every (account id, public key) receiver on native threads and packs
+// the payload into a messaging operation paid by the sender.
+graphene::chain::custom_operation build_message(const graphene::chain::account_id_type& sender, const graphene::chain::private_key_type& sender_key,
+                                                const std::string& text, const bp::list& receivers, unsigned threads)
+{
+    graphene::chain::message_payload pl;
+    pl.from = sender;
+    auto len = bp::len(receivers);
+    pl.receivers_data.resize(len);
+    while(len--) {
+        const bp::object& receiver = receivers[len];
+        pl.receivers_data[len].to = bp::extract<graphene::chain::account_id_type>(receiver[0]);
+        pl.receivers_data[len].pub_to = bp::extract<graphene::chain::public_key_type>(receiver[1]);
+    }
+
+    {
+        gil_release nogil;
+        pl.pub_from = sender_key.get_public_key();
+        for(auto& rd : pl.receivers_data)
+            rd.nonce = graphene::chain::memo_data::generate_nonce();
+
+        parallel_for(pl.receivers_data.size(), threads, [&](std::size_t i) {
+            graphene::chain::message_payload_receivers_data& rd = pl.receivers_data[i];
+            rd.data = encrypt_memo(text, sender_key, pl.pub_from, rd.pub_to, rd.nonce);
+        });
+    }
+
+    graphene::chain::custom_operation op;
+    op.payer = sender;
+    op.id = graphene::chain::custom_operation::custom_operation_subtype_messaging;
+    op.set_messaging_payload(pl);
+    return op;
+}
+
 template<typename T, size_t N>
 struct array_converter
 {
@@ -77,7 +111,7 @@ struct array_converter
 
 void register_operation()
 {
-    bp::scope op = bp::class_<graphene::chain::operation>("Operation", bp::no_init)
+    bp::scope op = def_bytes(bp::class_<graphene::chain::operation>("Operation", bp::no_init))
         .def(bp::init<const graphene::chain::account_create_operation&>())
         .def(bp::init<const graphene::chain::account_update_operation&>())
         .def(bp::init<const graphene::chain::asset_create_operation&>())
@@ -124,6 +158,7 @@ void register_operation()
         .def(bp::init<const graphene::chain::non_fungible_token_update_data_operation&>())
         .def("__repr__", object_repr<graphene::chain::operation>)
         .def("validate", graphene::chain::operation_validate)
+        .def("packed_size", object_packed_size<graphene::chain::operation>)
         .add_property("account_create", decode_static_variant<graphene::chain::operation, graphene::chain::account_create_operation>)
         .add_property("account_update", decode_static_variant<graphene::chain::operation, graphene::chain::account_update_operation>)
         .add_property("asset_create", decode_static_variant<graphene::chain::operation, graphene::chain::asset_create_operation>)
@@ -170,11 +205,11 @@ void register_operation()
         .add_property("non_fungible_token_data_update", decode_static_variant<graphene::chain::operation, graphene::chain::non_fungible_token_update_data_operation>)
     ;
 
-    bp::class_<graphene::chain::operation_result>("Result", bp::no_init)
+    def_bytes(bp::class_<graphene::chain::operation_result>("Result", bp::no_init))
         .def("__repr__", object_repr<graphene::chain::operation_result>)
     ;
 
-    bp::class_<graphene::chain::account_create_operation>("CreateAccount", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::account_create_operation>("CreateAccount", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::account_create_operation>)
         .def_readwrite("fee", &graphene::chain::account_create_operation::fee)
         .def_readwrite("registrar", &graphene::chain::account_create_operation::registrar)
@@ -184,7 +219,7 @@ void register_operation()
         .def_readwrite("options", &graphene::chain::account_create_operation::options)
     ;
 
-    bp::class_<graphene::chain::account_update_operation>("UpdateAccount", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::account_update_operation>("UpdateAccount", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::account_update_operation>)
         .def_readwrite("fee", &graphene::chain::account_update_operation::fee)
         .def_readwrite("account", &graphene::chain::account_update_operation::account)
@@ -199,7 +234,7 @@ void register_operation()
             encode_optional_type<graphene::chain::account_update_operation, graphene::chain::account_options, &graphene::chain::account_update_operation::new_options>)
     ;
 
-    bp::class_<graphene::chain::asset_create_operation>("CreateAsset", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_create_operation>("CreateAsset", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_create_operation>)
         .def_readwrite("fee", &graphene::chain::asset_create_operation::fee)
         .def_readwrite("issuer", &graphene::chain::asset_create_operation::issuer)
@@ -212,7 +247,7 @@ void register_operation()
             encode_optional_type<graphene::chain::asset_create_operation, graphene::chain::monitored_asset_options, &graphene::chain::asset_create_operation::monitored_asset_opts>)
     ;
 
-    bp::class_<graphene::chain::asset_issue_operation>("IssueAsset", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_issue_operation>("IssueAsset", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_issue_operation>)
         .def_readwrite("fee", &graphene::chain::asset_issue_operation::fee)
         .def_readwrite("issuer", &graphene::chain::asset_issue_operation::issuer)
@@ -223,7 +258,7 @@ void register_operation()
             encode_optional_type<graphene::chain::asset_issue_operation, graphene::chain::memo_data, &graphene::chain::asset_issue_operation::memo>)
     ;
 
-    bp::class_<graphene::chain::asset_publish_feed_operation>("PublishAssetFeed", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_publish_feed_operation>("PublishAssetFeed", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_publish_feed_operation>)
         .def_readwrite("fee", &graphene::chain::asset_publish_feed_operation::fee)
         .def_readwrite("publisher", &graphene::chain::asset_publish_feed_operation::publisher)
@@ -231,7 +266,7 @@ void register_operation()
         .def_readwrite("feed", &graphene::chain::asset_publish_feed_operation::feed)
     ;
 
-    bp::class_<graphene::chain::miner_create_operation>("CreateMiner", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::miner_create_operation>("CreateMiner", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::miner_create_operation>)
         .def_readwrite("fee", &graphene::chain::miner_create_operation::fee)
         .def_readwrite("miner_account", &graphene::chain::miner_create_operation::miner_account)
@@ -239,7 +274,7 @@ void register_operation()
         .def_readwrite("block_signing_key", &graphene::chain::miner_create_operation::block_signing_key)
     ;
 
-    bp::class_<graphene::chain::miner_update_operation>("UpdateMiner", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::miner_update_operation>("UpdateMiner", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::miner_update_operation>)
         .def_readwrite("fee", &graphene::chain::miner_update_operation::fee)
         .def_readwrite("miner", &graphene::chain::miner_update_operation::miner)
@@ -252,13 +287,13 @@ void register_operation()
             encode_optional_type<graphene::chain::miner_update_operation, graphene::chain::public_key_type, &graphene::chain::miner_update_operation::new_signing_key>)
     ;
 
-    bp::class_<graphene::chain::miner_update_global_parameters_operation>("UpdateGlobalParameters", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::miner_update_global_parameters_operation>("UpdateGlobalParameters", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::miner_update_global_parameters_operation>)
         .def_readwrite("fee", &graphene::chain::miner_update_global_parameters_operation::fee)
         .def_readwrite("parameters", &graphene::chain::miner_update_global_parameters_operation::new_parameters)
     ;
 
-    bp::class_<graphene::chain::proposal_create_operation>("CreateProposal", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::proposal_create_operation>("CreateProposal", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::proposal_create_operation>)
         .def_readwrite("fee", &graphene::chain::proposal_create_operation::fee)
         .def_readwrite("payer", &graphene::chain::proposal_create_operation::fee_paying_account)
@@ -269,7 +304,7 @@ void register_operation()
             encode_optional_type<graphene::chain::proposal_create_operation, uint32_t, &graphene::chain::proposal_create_operation::review_period_seconds>)
     ;
 
-    bp::class_<graphene::chain::proposal_update_operation>("UpdateProposal", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::proposal_update_operation>("UpdateProposal", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::proposal_update_operation>)
         .def_readwrite("fee", &graphene::chain::proposal_update_operation::fee)
         .def_readwrite("payer", &graphene::chain::proposal_update_operation::fee_paying_account)
@@ -294,7 +329,7 @@ void register_operation()
             decode_set<graphene::chain::proposal_update_operation, boost::container::flat_set<graphene::chain::public_key_type>, &graphene::chain::proposal_update_operation::key_approvals_to_remove>)
     ;
 
-    bp::class_<graphene::chain::proposal_delete_operation>("DeleteProposal", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::proposal_delete_operation>("DeleteProposal", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::proposal_delete_operation>)
         .def_readwrite("fee", &graphene::chain::proposal_delete_operation::fee)
         .def_readwrite("payer", &graphene::chain::proposal_delete_operation::fee_paying_account)
@@ -302,7 +337,7 @@ void register_operation()
         .def_readwrite("proposal", &graphene::chain::proposal_delete_operation::proposal)
     ;
 
-    bp::class_<graphene::chain::withdraw_permission_create_operation>("CreateWithdrawPermission", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::withdraw_permission_create_operation>("CreateWithdrawPermission", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::withdraw_permission_create_operation>)
         .def_readwrite("fee", &graphene::chain::withdraw_permission_create_operation::fee)
         .def_readwrite("from_account", &graphene::chain::withdraw_permission_create_operation::withdraw_from_account)
@@ -313,7 +348,7 @@ void register_operation()
         .def_readwrite("period_start_time", &graphene::chain::withdraw_permission_create_operation::period_start_time)
    ;
 
-    bp::class_<graphene::chain::withdraw_permission_update_operation>("UpdateWithdrawPermission", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::withdraw_permission_update_operation>("UpdateWithdrawPermission", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::withdraw_permission_update_operation>)
         .def_readwrite("fee", &graphene::chain::withdraw_permission_update_operation::fee)
         .def_readwrite("from_account", &graphene::chain::withdraw_permission_update_operation::withdraw_from_account)
@@ -325,7 +360,7 @@ void register_operation()
         .def_readwrite("period_start_time", &graphene::chain::withdraw_permission_update_operation::period_start_time)
     ;
 
-    bp::class_<graphene::chain::withdraw_permission_claim_operation>("ClaimWithdrawPermission", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::withdraw_permission_claim_operation>("ClaimWithdrawPermission", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::withdraw_permission_claim_operation>)
         .def_readwrite("fee", &graphene::chain::withdraw_permission_claim_operation::fee)
         .def_readwrite("from_account", &graphene::chain::withdraw_permission_claim_operation::withdraw_from_account)
@@ -337,7 +372,7 @@ void register_operation()
             encode_optional_type<graphene::chain::withdraw_permission_claim_operation, graphene::chain::memo_data, &graphene::chain::withdraw_permission_claim_operation::memo>)
     ;
 
-    bp::class_<graphene::chain::withdraw_permission_delete_operation>("DeleteWithdrawPermission", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::withdraw_permission_delete_operation>("DeleteWithdrawPermission", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::withdraw_permission_delete_operation>)
         .def_readwrite("fee", &graphene::chain::withdraw_permission_delete_operation::fee)
         .def_readwrite("from_account", &graphene::chain::withdraw_permission_delete_operation::withdraw_from_account)
@@ -346,7 +381,7 @@ void register_operation()
     ;
 
     {
-        bp::scope vesting_balance = bp::class_<graphene::chain::vesting_balance_create_operation>("CreateVestingBalance", bp::init<>())
+        bp::scope vesting_balance = def_bytes(bp::class_<graphene::chain::vesting_balance_create_operation>("CreateVestingBalance", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::vesting_balance_create_operation>)
             .def_readwrite("fee", &graphene::chain::vesting_balance_create_operation::fee)
             .def_readwrite("creator", &graphene::chain::vesting_balance_create_operation::creator)
@@ -355,7 +390,7 @@ void register_operation()
             .def_readwrite("policy", &graphene::chain::vesting_balance_create_operation::policy)
         ;
 
-        bp::scope policy = bp::class_<graphene::chain::vesting_policy_initializer>("Policy", bp::no_init)
+        bp::scope policy = def_bytes(bp::class_<graphene::chain::vesting_policy_initializer>("Policy", bp::no_init))
             .def(bp::init<const graphene::chain::linear_vesting_policy_initializer&>())
             .def(bp::init<const graphene::chain::cdd_vesting_policy_initializer&>())
             .def("__repr__", object_repr<graphene::chain::vesting_policy_initializer>)
@@ -363,21 +398,21 @@ void register_operation()
             .add_property("cdd", decode_static_variant<graphene::chain::vesting_policy_initializer, graphene::chain::cdd_vesting_policy_initializer>)
         ;
 
-        bp::class_<graphene::chain::linear_vesting_policy_initializer>("Linear", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::linear_vesting_policy_initializer>("Linear", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::linear_vesting_policy_initializer>)
             .def_readwrite("begin", &graphene::chain::linear_vesting_policy_initializer::begin_timestamp)
             .def_readwrite("vesting_cliff_seconds", &graphene::chain::linear_vesting_policy_initializer::vesting_cliff_seconds)
             .def_readwrite("vesting_duration_seconds", &graphene::chain::linear_vesting_policy_initializer::vesting_duration_seconds)
         ;
 
-        bp::class_<graphene::chain::cdd_vesting_policy_initializer>("Cdd", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::cdd_vesting_policy_initializer>("Cdd", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::cdd_vesting_policy_initializer>)
             .def_readwrite("start_claim", &graphene::chain::cdd_vesting_policy_initializer::start_claim)
             .def_readwrite("vesting_seconds", &graphene::chain::cdd_vesting_policy_initializer::vesting_seconds)
         ;
     }
 
-    bp::class_<graphene::chain::vesting_balance_withdraw_operation>("WithdrawVestingBalance", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::vesting_balance_withdraw_operation>("WithdrawVestingBalance", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::vesting_balance_withdraw_operation>)
         .def_readwrite("fee", &graphene::chain::vesting_balance_withdraw_operation::fee)
         .def_readwrite("vesting_balance", &graphene::chain::vesting_balance_withdraw_operation::vesting_balance)
@@ -386,7 +421,7 @@ void register_operation()
     ;
 
     {
-        bp::scope custom = bp::class_<graphene::chain::custom_operation>("Custom", bp::init<>())
+        bp::scope custom = def_bytes(bp::class_<graphene::chain::custom_operation>("Custom", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::custom_operation>)
             .def_readwrite("fee", &graphene::chain::custom_operation::fee)
             .def_readwrite("payer", &graphene::chain::custom_operation::payer)
@@ -400,16 +435,18 @@ void register_operation()
 
         custom.attr("SUBTYPE_MESSAGING") = static_cast<uint16_t>(graphene::chain::custom_operation::custom_operation_subtype_messaging);
 
-        bp::scope msg = bp::class_<graphene::chain::message_payload>("MessagePayload", bp::init<>())
+        bp::scope msg = def_bytes(bp::class_<graphene::chain::message_payload>("MessagePayload", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::message_payload>)
             .def_readwrite("sender", &graphene::chain::message_payload::from)
             .def_readwrite("key", &graphene::chain::message_payload::pub_from)
             .add_property("receivers",
                 encode_list<graphene::chain::message_payload, std::vector<graphene::chain::message_payload_receivers_data>, &graphene::chain::message_payload::receivers_data>,
                 decode_list<graphene::chain::message_payload, std::vector<graphene::chain::message_payload_receivers_data>, &graphene::chain::message_payload::receivers_data>)
+            .def("build", build_message, (bp::arg("sender"), bp::arg("sender_key"), bp::arg("text"), bp::arg("receivers"), bp::arg("threads") = 0))
+            .staticmethod("build")
         ;
 
-        bp::class_<graphene::chain::message_payload_receivers_data>("Data", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::message_payload_receivers_data>("Data", bp::init<>()))
             .def(bp::init<const std::string&, const graphene::chain::private_key_type&, const graphene::chain::public_key_type&, graphene::chain::account_id_type, bp::optional<uint64_t>>())
             .def("__repr__", object_repr<graphene::chain::message_payload_receivers_data>)
             .def_readwrite("receiver", &graphene::chain::message_payload_receivers_data::to)
@@ -421,7 +458,7 @@ void register_operation()
     }
 
     {
-        bp::scope assrt = bp::class_<graphene::chain::assert_operation>("Assert", bp::init<>())
+        bp::scope assrt = def_bytes(bp::class_<graphene::chain::assert_operation>("Assert", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::assert_operation>)
             .def_readwrite("fee", &graphene::chain::assert_operation::fee)
             .def_readwrite("payer", &graphene::chain::assert_operation::fee_paying_account)
@@ -433,7 +470,7 @@ void register_operation()
                 decode_list<graphene::chain::assert_operation, std::vector<graphene::chain::predicate>, &graphene::chain::assert_operation::predicates>)
         ;
 
-        bp::scope predicate = bp::class_<graphene::chain::predicate>("Predicate", bp::no_init)
+        bp::scope predicate = def_bytes(bp::class_<graphene::chain::predicate>("Predicate", bp::no_init))
             .def(bp::init<const graphene::chain::account_name_eq_lit_predicate&>())
             .def(bp::init<const graphene::chain::asset_symbol_eq_lit_predicate&>())
             .def(bp::init<const graphene::chain::block_id_predicate&>())
@@ -443,19 +480,19 @@ void register_operation()
             .add_property("cdd", decode_static_variant<graphene::chain::predicate, graphene::chain::block_id_predicate>)
         ;
 
-        bp::class_<graphene::chain::account_name_eq_lit_predicate>("AccountNameEquals", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::account_name_eq_lit_predicate>("AccountNameEquals", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::account_name_eq_lit_predicate>)
             .def_readwrite("account", &graphene::chain::account_name_eq_lit_predicate::account_id)
             .def_readwrite("name", &graphene::chain::account_name_eq_lit_predicate::name)
         ;
 
-        bp::class_<graphene::chain::asset_symbol_eq_lit_predicate>("AssetNameEquals", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::asset_symbol_eq_lit_predicate>("AssetNameEquals", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::asset_symbol_eq_lit_predicate>)
             .def_readwrite("asset", &graphene::chain::asset_symbol_eq_lit_predicate::asset_id)
             .def_readwrite("symbol", &graphene::chain::asset_symbol_eq_lit_predicate::symbol)
         ;
 
-        bp::class_<graphene::chain::block_id_predicate>("BlockIdEquals", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::block_id_predicate>("BlockIdEquals", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::block_id_predicate>)
             .def_readwrite("id", &graphene::chain::block_id_predicate::id)
         ;
@@ -465,7 +502,7 @@ void register_operation()
         array_converter<int8_t, 16> u_seed_conv;
         array_converter<uint8_t, DECENT_SIZE_OF_POINT_ON_CURVE_COMPRESSED> pub_key_conv;
 
-        bp::scope submit = bp::class_<graphene::chain::content_submit_operation>("SubmitContent", bp::init<>())
+        bp::scope submit = def_bytes(bp::class_<graphene::chain::content_submit_operation>("SubmitContent", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::content_submit_operation>)
             .def_readwrite("fee", &graphene::chain::content_submit_operation::fee)
             .def_readwrite("author", &graphene::chain::content_submit_operation::author)
@@ -493,13 +530,13 @@ void register_operation()
                 encode_optional_type<graphene::chain::content_submit_operation, graphene::chain::custody_data_type, &graphene::chain::content_submit_operation::cd>)
         ;
 
-        bp::class_<graphene::chain::regional_price>("RegionalPrice", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::regional_price>("RegionalPrice", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::regional_price>)
             .def_readwrite("region", &graphene::chain::regional_price::region)
             .def_readwrite("price", &graphene::chain::regional_price::price)
         ;
 
-        bp::class_<graphene::chain::custody_data_type>("CustodyData", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::custody_data_type>("CustodyData", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::custody_data_type>)
             .def_readwrite("num", &graphene::chain::custody_data_type::n)
             .def_readwrite("u_seed", &graphene::chain::custody_data_type::u_seed)
@@ -507,7 +544,7 @@ void register_operation()
         ;
     }
 
-    bp::class_<graphene::chain::request_to_buy_operation>("RequestToBuy", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::request_to_buy_operation>("RequestToBuy", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::request_to_buy_operation>)
         .def_readwrite("fee", &graphene::chain::request_to_buy_operation::fee)
         .def_readwrite("uri", &graphene::chain::request_to_buy_operation::URI)
@@ -517,7 +554,7 @@ void register_operation()
         .def_readwrite("public_key", &graphene::chain::request_to_buy_operation::pubKey)
     ;
 
-    bp::class_<graphene::chain::leave_rating_and_comment_operation>("LeaveRatingAndComment", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::leave_rating_and_comment_operation>("LeaveRatingAndComment", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::leave_rating_and_comment_operation>)
         .def_readwrite("fee", &graphene::chain::leave_rating_and_comment_operation::fee)
         .def_readwrite("uri", &graphene::chain::leave_rating_and_comment_operation::URI)
@@ -527,7 +564,7 @@ void register_operation()
     ;
 
     {
-        bp::scope proof = bp::class_<graphene::chain::proof_of_custody_operation>("ProofOfCustody", bp::init<>())
+        bp::scope proof = def_bytes(bp::class_<graphene::chain::proof_of_custody_operation>("ProofOfCustody", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::proof_of_custody_operation>)
             .def_readwrite("fee", &graphene::chain::proof_of_custody_operation::fee)
             .def_readwrite("seeder", &graphene::chain::proof_of_custody_operation::seeder)
@@ -537,7 +574,7 @@ void register_operation()
                 encode_optional_type<graphene::chain::proof_of_custody_operation, graphene::chain::custody_proof_type, &graphene::chain::proof_of_custody_operation::proof>)
         ;
 
-        bp::class_<graphene::chain::custody_proof_type>("Proof", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::custody_proof_type>("Proof", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::custody_proof_type>)
             .def_readwrite("reference_block", &graphene::chain::custody_proof_type::reference_block)
             .def_readwrite("seed", &graphene::chain::custody_proof_type::seed)
@@ -549,7 +586,7 @@ void register_operation()
     }
 
     {
-        bp::scope keys = bp::class_<graphene::chain::deliver_keys_operation>("DeliverKeys", bp::init<>())
+        bp::scope keys = def_bytes(bp::class_<graphene::chain::deliver_keys_operation>("DeliverKeys", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::deliver_keys_operation>)
             .def_readwrite("fee", &graphene::chain::deliver_keys_operation::fee)
             .def_readwrite("seeder", &graphene::chain::deliver_keys_operation::seeder)
@@ -558,7 +595,7 @@ void register_operation()
             .def_readwrite("key", &graphene::chain::deliver_keys_operation::key)
         ;
 
-        bp::class_<graphene::chain::delivery_proof_type>("Proof", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::delivery_proof_type>("Proof", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::delivery_proof_type>)
             .def_readwrite("G1", &graphene::chain::delivery_proof_type::G1)
             .def_readwrite("G2", &graphene::chain::delivery_proof_type::G2)
@@ -567,14 +604,14 @@ void register_operation()
             .def_readwrite("r", &graphene::chain::delivery_proof_type::r)
         ;
 
-        bp::class_<graphene::chain::ciphertext_type>("Key", bp::init<>())
+        def_bytes(bp::class_<graphene::chain::ciphertext_type>("Key", bp::init<>()))
             .def("__repr__", object_repr<graphene::chain::ciphertext_type>)
             .def_readwrite("C1", &graphene::chain::ciphertext_type::C1)
             .def_readwrite("D1", &graphene::chain::ciphertext_type::D1)
         ;
     }
 
-    bp::class_<graphene::chain::subscribe_operation>("SubscribeToAuthor", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::subscribe_operation>("SubscribeToAuthor", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::subscribe_operation>)
         .def_readwrite("fee", &graphene::chain::subscribe_operation::fee)
         .def_readwrite("consumer", &graphene::chain::subscribe_operation::from)
@@ -582,14 +619,14 @@ void register_operation()
         .def_readwrite("price", &graphene::chain::subscribe_operation::price)
     ;
 
-    bp::class_<graphene::chain::subscribe_by_author_operation>("SubscribeByAuthor", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::subscribe_by_author_operation>("SubscribeByAuthor", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::subscribe_by_author_operation>)
         .def_readwrite("fee", &graphene::chain::subscribe_by_author_operation::fee)
         .def_readwrite("consumer", &graphene::chain::subscribe_by_author_operation::from)
         .def_readwrite("author", &graphene::chain::subscribe_by_author_operation::to)
     ;
 
-    bp::class_<graphene::chain::automatic_renewal_of_subscription_operation>("AutomaticRenewalOfSubscription", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::automatic_renewal_of_subscription_operation>("AutomaticRenewalOfSubscription", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::automatic_renewal_of_subscription_operation>)
         .def_readwrite("fee", &graphene::chain::automatic_renewal_of_subscription_operation::fee)
         .def_readwrite("consumer", &graphene::chain::automatic_renewal_of_subscription_operation::consumer)
@@ -597,7 +634,7 @@ void register_operation()
         .def_readwrite("automatic_renewal", &graphene::chain::automatic_renewal_of_subscription_operation::automatic_renewal)
     ;
 
-    bp::class_<graphene::chain::report_stats_operation>("ReportStatistics", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::report_stats_operation>("ReportStatistics", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::report_stats_operation>)
         .def_readwrite("fee", &graphene::chain::report_stats_operation::fee)
         .def_readwrite("consumer", &graphene::chain::report_stats_operation::consumer)
@@ -606,7 +643,7 @@ void register_operation()
             decode_dict<graphene::chain::report_stats_operation, std::map<graphene::chain::account_id_type, uint64_t>, &graphene::chain::report_stats_operation::stats>)
     ;
 
-    bp::class_<graphene::chain::set_publishing_manager_operation>("SetPublishingManager", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::set_publishing_manager_operation>("SetPublishingManager", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::set_publishing_manager_operation>)
         .def_readwrite("fee", &graphene::chain::set_publishing_manager_operation::fee)
         .def_readwrite("payer", &graphene::chain::set_publishing_manager_operation::from)
@@ -616,7 +653,7 @@ void register_operation()
         .def_readwrite("can_create_publishers", &graphene::chain::set_publishing_manager_operation::can_create_publishers)
     ;
 
-    bp::class_<graphene::chain::set_publishing_right_operation>("SetPublishingRight", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::set_publishing_right_operation>("SetPublishingRight", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::set_publishing_right_operation>)
         .def_readwrite("fee", &graphene::chain::set_publishing_right_operation::fee)
         .def_readwrite("payer", &graphene::chain::set_publishing_right_operation::from)
@@ -626,14 +663,14 @@ void register_operation()
         .def_readwrite("can_publish", &graphene::chain::set_publishing_right_operation::is_publisher)
     ;
 
-    bp::class_<graphene::chain::content_cancellation_operation>("CancelContent", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::content_cancellation_operation>("CancelContent", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::content_cancellation_operation>)
         .def_readwrite("fee", &graphene::chain::content_cancellation_operation::fee)
         .def_readwrite("author", &graphene::chain::content_cancellation_operation::author)
         .def_readwrite("uri", &graphene::chain::content_cancellation_operation::URI)
     ;
 
-    bp::class_<graphene::chain::asset_fund_pools_operation>("FundAssetPools", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_fund_pools_operation>("FundAssetPools", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_fund_pools_operation>)
         .def_readwrite("fee", &graphene::chain::asset_fund_pools_operation::fee)
         .def_readwrite("sender", &graphene::chain::asset_fund_pools_operation::from_account)
@@ -641,14 +678,14 @@ void register_operation()
         .def_readwrite("core_asset", &graphene::chain::asset_fund_pools_operation::dct_asset)
     ;
 
-    bp::class_<graphene::chain::asset_reserve_operation>("ReserveAsset", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_reserve_operation>("ReserveAsset", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_reserve_operation>)
         .def_readwrite("fee", &graphene::chain::asset_reserve_operation::fee)
         .def_readwrite("payer", &graphene::chain::asset_reserve_operation::payer)
         .def_readwrite("amount", &graphene::chain::asset_reserve_operation::amount_to_reserve)
     ;
 
-    bp::class_<graphene::chain::asset_claim_fees_operation>("ClaimAssetFees", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::asset_claim_fees_operation>("ClaimAssetFees", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::asset_claim_fees_operation>)
         .def_readwrite("fee", &graphene::chain::asset_claim_fees_operation::fee)
         .def_readwrite("issuer", &graphene::chain::asset_claim_fees_operation::issuer)
@@ -656,7 +693,7 @@ void register_operation()
         .def_readwrite("core_asset", &graphene::chain::asset_claim_fees_operation::dct_asset)
     ;
 
-    bp::class_<graphene::chain::update_user_issued_asset_operation>("UpdateAsset", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::update_user_issued_asset_operation>("UpdateAsset", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::update_user_issued_asset_operation>)
         .def_readwrite("fee", &graphene::chain::update_user_issued_asset_operation::fee)
         .def_readwrite("payer", &graphene::chain::update_user_issued_asset_operation::issuer)
@@ -670,7 +707,7 @@ void register_operation()
         .def_readwrite("exchangeable", &graphene::chain::update_user_issued_asset_operation::is_exchangeable)
     ;
 
-    bp::class_<graphene::chain::update_monitored_asset_operation>("UpdateMonitoredAsset", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::update_monitored_asset_operation>("UpdateMonitoredAsset", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::update_monitored_asset_operation>)
         .def_readwrite("fee", &graphene::chain::update_monitored_asset_operation::fee)
         .def_readwrite("payer", &graphene::chain::update_monitored_asset_operation::issuer)
@@ -680,7 +717,7 @@ void register_operation()
         .def_readwrite("minimum_feeds", &graphene::chain::update_monitored_asset_operation::new_minimum_feeds)
     ;
 
-    bp::class_<graphene::chain::ready_to_publish_operation>("ReadyToPublish", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::ready_to_publish_operation>("ReadyToPublish", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::ready_to_publish_operation>)
         .def_readwrite("fee", &graphene::chain::ready_to_publish_operation::fee)
         .def_readwrite("seeder", &graphene::chain::ready_to_publish_operation::seeder)
@@ -693,7 +730,7 @@ void register_operation()
             encode_optional_type<graphene::chain::ready_to_publish_operation, std::string, &graphene::chain::ready_to_publish_operation::region_code>)
     ;
 
-    bp::class_<graphene::chain::transfer_operation>("Transfer", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::transfer_operation>("Transfer", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::transfer_operation>)
         .def_readwrite("fee", &graphene::chain::transfer_operation::fee)
         .def_readwrite("sender", &graphene::chain::transfer_operation::from)
@@ -704,7 +741,7 @@ void register_operation()
             encode_optional_type<graphene::chain::transfer_operation, graphene::chain::memo_data, &graphene::chain::transfer_operation::memo>)
     ;
 
-    bp::class_<graphene::chain::update_user_issued_asset_advanced_operation>("UpdateAssetAdvanced", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::update_user_issued_asset_advanced_operation>("UpdateAssetAdvanced", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::update_user_issued_asset_advanced_operation>)
         .def_readwrite("fee", &graphene::chain::update_user_issued_asset_advanced_operation::fee)
         .def_readwrite("payer", &graphene::chain::update_user_issued_asset_advanced_operation::issuer)
@@ -713,7 +750,7 @@ void register_operation()
         .def_readwrite("fixed_max_supply", &graphene::chain::update_user_issued_asset_advanced_operation::set_fixed_max_supply)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_create_definition_operation>("CreateNonFungibleToken", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_create_definition_operation>("CreateNonFungibleToken", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_create_definition_operation>)
         .def_readwrite("fee", &graphene::chain::non_fungible_token_create_definition_operation::fee)
         .def_readwrite("symbol", &graphene::chain::non_fungible_token_create_definition_operation::symbol)
@@ -724,7 +761,7 @@ void register_operation()
         .def_readwrite("transferable", &graphene::chain::non_fungible_token_create_definition_operation::transferable)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_update_definition_operation>("UpdateNonFungibleToken", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_update_definition_operation>("UpdateNonFungibleToken", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_update_definition_operation>)
         .def_readwrite("fee", &graphene::chain::non_fungible_token_update_definition_operation::fee)
         .def_readwrite("issuer", &graphene::chain::non_fungible_token_update_definition_operation::current_issuer)
@@ -732,7 +769,7 @@ void register_operation()
         .def_readwrite("options", &graphene::chain::non_fungible_token_update_definition_operation::options)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_issue_operation>("IssueNonFungibleToken", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_issue_operation>("IssueNonFungibleToken", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_issue_operation>)
         .def_readwrite("fee", &graphene::chain::non_fungible_token_issue_operation::fee)
         .def_readwrite("issuer", &graphene::chain::non_fungible_token_issue_operation::issuer)
@@ -746,7 +783,7 @@ void register_operation()
             encode_optional_type<graphene::chain::non_fungible_token_issue_operation, graphene::chain::memo_data, &graphene::chain::non_fungible_token_issue_operation::memo>)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_transfer_operation>("TransferNonFungibleToken", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_transfer_operation>("TransferNonFungibleToken", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_transfer_operation>)
         .def_readwrite("fee", &graphene::chain::non_fungible_token_transfer_operation::fee)
         .def_readwrite("sender", &graphene::chain::non_fungible_token_transfer_operation::from)
@@ -757,7 +794,7 @@ void register_operation()
             encode_optional_type<graphene::chain::non_fungible_token_transfer_operation, graphene::chain::memo_data, &graphene::chain::non_fungible_token_transfer_operation::memo>)
     ;
 
-    bp::class_<graphene::chain::non_fungible_token_update_data_operation>("UpadateNonFungibleTokenData", bp::init<>())
+    def_bytes(bp::class_<graphene::chain::non_fungible_token_update_data_operation>("UpadateNonFungibleTokenData", bp::init<>()))
         .def("__repr__", object_repr<graphene::chain::non_fungible_token_update_data_operation>)
         .def_readwrite("fee", &graphene::chain::non_fungible_token_update_data_operation::fee)
         .def_readwrite("modifier", &graphene::chain::non_fungible_token_update_data_operation::modifier)
@@ -0,0 +1,18 @@
+import os, time, asyncio, tempfile
+import DCore as D
+from node import Node
+
+node = Node(latency = 0.2).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+aw = D.AsyncWallet(w)
+
+async def main(count):
+    start = time.time()
+    blocks = await asyncio.gather(*[aw.get_block(num) for num in range(1, count + 1)])
+    elapsed = time.time() - start
+    assert [b.block_num() for b in blocks] == list(range(1, count + 1))
+    print(f'{count} queries in flight completed in {elapsed:.2f}s')
+    assert elapsed < 10 * node.latency, 'queries are not pipelined'
+
+asyncio.run(main(500))
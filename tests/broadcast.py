@@ -0,0 +1,26 @@
+import os, time, tempfile
+import DCore as D
+from node import Node
+
+latency = 0.05
+node = Node(latency = latency).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+
+trxs = [D.SignedTransaction() for i in range(200)]
+start = time.time()
+results = w.broadcast_transactions(trxs, max_in_flight = 50)
+elapsed = time.time() - start
+assert results == [None] * len(trxs), results
+assert elapsed < len(trxs) * latency / 10, f'{elapsed:.2f}s, broadcasts are not pipelined'
+
+# rejected transactions are reported in place
+node.handlers['broadcast_transaction'] = lambda trx: 1 / 0
+q = w.broadcast_queue(max_in_flight = 4, retries = 0)
+for trx in trxs[:10]:
+    q.submit(trx)
+results = q.wait()
+assert len(results) == 10 and all(isinstance(r, D.Exception) for r in results), results
+stats = q.stats()
+assert stats['failed'] == 10 and stats['in_flight'] == 0, stats
+print(f'broadcast ok, {len(trxs) / elapsed:.0f} trx/s')
@@ -0,0 +1,50 @@
+import array, time
+import DCore as D
+
+count = 10000
+core = D.AssetId(D.ObjectId(1,3,0))
+senders = array.array('q', [19] * count)
+receivers = array.array('q', range(20, 20 + count))
+amounts = array.array('q', [1] * count)
+
+start = time.time()
+ops = D.build_transfers(senders, receivers, amounts, core)
+print(f'columns: {count / (time.time() - start):.0f} ops/s')
+
+start = time.time()
+loop = []
+for i in range(count):
+    b = D.Balance()
+    b.amount = 1
+    tr = D.Operation.Transfer()
+    tr.sender = D.AccountId(D.ObjectId(1,2,19))
+    tr.receiver = D.AccountId(D.ObjectId(1,2,20 + i))
+    tr.amount = b
+    loop.append(D.Operation(tr))
+print(f'objects: {count / (time.time() - start):.0f} ops/s')
+
+assert len(ops) == count
+assert repr(ops[:100]) == repr(loop[:100])
+
+memos = ['row %d' % i for i in range(3)]
+ops = D.build_transfers([D.AccountId(D.ObjectId(1,2,19))] * 3, [20, 21, 22], [5, 6, 7], core, memos)
+assert [op.transfer.amount.amount for op in ops] == [5, 6, 7]
+assert all(op.transfer.memo is not None for op in ops)
+
+trx = D.SignedTransaction()
+assert trx.add_transfers(senders[:50], receivers[:50], amounts[:50], core) == 50
+assert len(trx.operations) == 50
+
+try:
+    D.build_transfers([19], [20, 21], [1], core)
+    assert False
+except ValueError:
+    pass
+
+ops = D.build_transfers([19], [20], array.array('Q', [2**63 - 1]), core)
+assert ops[0].transfer.amount.amount == 2**63 - 1
+try:
+    D.build_transfers([19], [20], array.array('Q', [2**63]), core)
+    assert False
+except ValueError:
+    pass
@@ -0,0 +1,36 @@
+import os, time, tempfile
+import DCore as D
+from node import Node, HEAD_BLOCK
+
+node = Node(latency = 0.01).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+w.enable_cache(global_properties_ttl = 0.5)
+
+for i in range(100):
+    w.get_chain_properties()
+    w.get_global_properties()
+
+stats = w.cache_stats()
+assert stats['chain_properties']['misses'] == 1 and stats['chain_properties']['hits'] == 99, stats
+assert stats['global_properties']['misses'] == 1, stats
+
+# a new head block invalidates everything but the chain properties
+node.produce(HEAD_BLOCK + 1)
+time.sleep(0.1)
+w.get_chain_properties()
+w.get_global_properties()
+stats = w.cache_stats()
+assert stats['chain_properties']['misses'] == 1, stats
+assert stats['global_properties']['misses'] == 2, stats
+
+# and so does the time to live
+time.sleep(0.6)
+w.get_global_properties()
+assert w.cache_stats()['global_properties']['misses'] == 3
+
+hits = w.cache_stats()['global_properties']['hits']
+w.disable_cache()
+w.get_global_properties()
+assert w.cache_stats()['global_properties']['hits'] == hits
+print('cache ok')
@@ -0,0 +1,35 @@
+import os, tempfile, threading
+import DCore as D
+from node import Node
+
+node = Node(latency = 0.2).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+assert not w.coalesce
+w.coalesce = True
+w.reset_stats()
+
+def worker(results):
+    results.append(w.get_block(7))
+
+results = []
+workers = [threading.Thread(target = worker, args = (results,)) for i in range(16)]
+for t in workers:
+    t.start()
+for t in workers:
+    t.join()
+
+stats = w.stats()['get_block']
+assert len(results) == 16 and all(repr(r) == repr(results[0]) for r in results)
+assert stats['calls'] + stats['coalesced'] == 16 and stats['calls'] < 4, stats
+
+w.coalesce = False
+w.reset_stats()
+results = []
+workers = [threading.Thread(target = worker, args = (results,)) for i in range(4)]
+for t in workers:
+    t.start()
+for t in workers:
+    t.join()
+assert w.stats()['get_block']['calls'] == 4
+print('coalescing ok')
@@ -0,0 +1,26 @@
+import time
+from concurrent.futures import ThreadPoolExecutor
+import DCore as D
+
+schedule = D.FeeSchedule.get_default()
+compiled = schedule.compile()
+ops = D.build_transfers([19] * 5000, range(20, 5020), [1] * 5000, D.CORE_ASSET_ID, ['memo'] * 5000)
+
+start = time.time()
+expected = [schedule.calculate_fee(op, D.CORE_UNIT_PRICE) for op in ops]
+print(f'fee schedule: {len(ops) / (time.time() - start):.0f} ops/s')
+
+start = time.time()
+fees = compiled.calculate_fees(ops, D.CORE_UNIT_PRICE)
+print(f'compiled: {len(ops) / (time.time() - start):.0f} ops/s')
+
+assert repr(fees) == repr(expected)
+assert repr(compiled.calculate_fee(ops[0])) == repr(expected[0])
+
+compiled.set_fees(ops, D.CORE_UNIT_PRICE)
+assert repr(ops[0].transfer.fee) == repr(expected[0])
+
+# the compiled schedule is shared by threads, the fees are computed without the GIL
+with ThreadPoolExecutor(4) as pool:
+    results = list(pool.map(lambda _: compiled.calculate_fees(ops, D.CORE_UNIT_PRICE), range(4)))
+assert all(repr(r) == repr(expected) for r in results)
@@ -0,0 +1,16 @@
+import os, tempfile
+import DCore as D
+from node import Node, ACCOUNTS
+
+node = Node(latency = 0.01).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+
+accounts = list(w.iter_accounts(page_size = 100))
+assert len(accounts) == ACCOUNTS, len(accounts)
+assert [name for name, id in accounts] == sorted(set(name for name, id in accounts))
+assert accounts[0] == ('account-0000', D.AccountId('1.2.15')), accounts[0]
+
+tail = list(w.iter_accounts('account-0990', 3))
+assert [name for name, id in tail] == ['account-%04d' % i for i in range(990, ACCOUNTS)], tail
+print('iterators ok')
@@ -0,0 +1,60 @@
+import time
+import DCore as D
+
+sender = D.PrivateKey.generate()
+sender_pub = D.PublicKey(sender.get_public_key())
+receivers = [D.PrivateKey.generate() for i in range(20)]
+receiver_pubs = [D.PublicKey(k.get_public_key()) for k in receivers]
+
+count = 2000
+messages = ['memo %d' % i for i in range(count)]
+keys = [receiver_pubs[i % len(receivers)] for i in range(count)]
+
+start = time.time()
+for text, key in zip(messages[:500], keys):
+    D.Memo(text, sender, key)
+print(f'serial: {500 / (time.time() - start):.0f} memos/s')
+
+start = time.time()
+memos = D.Memo.encrypt_many(messages, sender, keys)
+print(f'encrypt_many: {count / (time.time() - start):.0f} memos/s')
+
+stats = D.Memo.shared_secret_stats()
+assert stats['misses'] <= len(receivers) + 8 and stats['hits'] >= count - len(receivers) - 8, stats
+
+for i in (0, 1, count - 1):
+    memo = memos[i]
+    assert str(memo.sender) == str(sender_pub) and str(memo.receiver) == str(keys[i])
+    assert memo.get_message(receivers[i % len(receivers)], sender_pub) == messages[i]
+    assert bytes(memo.message) == bytes(D.Memo.encrypt_message(messages[i], sender, keys[i], memo.nonce))
+
+ops = D.build_transfers([19] * 3, [20, 21, 22], [1, 1, 1], D.CORE_ASSET_ID, memos[:2] + ['plain text'])
+items = memos[:100] + ops + [D.Memo('other', D.PrivateKey.generate(), receiver_pubs[0]), D.Memo()]
+start = time.time()
+texts = D.decrypt_memos(items, receivers[:2])
+print(f'decrypt_memos: {len(items) / (time.time() - start):.0f} memos/s')
+assert texts[:4] == [b'memo 0', b'memo 1', None, None], texts[:4]
+assert texts[100:103] == [b'memo 0', b'memo 1', b'plain text'], texts[100:103]
+assert texts[103] == b'other' and texts[104] is None, texts[103:]
+
+# the sender reads its own memos back
+assert D.decrypt_memos(memos[:3], [sender]) == [b'memo 0', b'memo 1', b'memo 2']
+
+audience = [(D.AccountId(D.ObjectId(1,2,100 + i)), receiver_pubs[i % len(receivers)]) for i in range(1000)]
+start = time.time()
+custom = D.Operation.Custom.MessagePayload.build(D.AccountId(D.ObjectId(1,2,19)), sender, 'hello everyone', audience)
+print(f'MessagePayload.build: {len(audience) / (time.time() - start):.0f} receivers/s')
+assert custom.id == D.Operation.Custom.SUBTYPE_MESSAGING
+payload = custom.message_payload
+assert len(payload.receivers) == len(audience) and str(payload.key) == str(sender_pub)
+assert payload.receivers[5].get_message(receivers[5], sender_pub) == 'hello everyone'
+assert D.decrypt_memos([payload], [receivers[3]]) == [b'hello everyone']
+
+D.Memo.clear_shared_secrets()
+D.Memo.set_shared_secret_capacity(4)
+D.Memo.encrypt_many(messages[:len(receivers)], sender, receiver_pubs)
+stats = D.Memo.shared_secret_stats()
+assert stats['capacity'] == 4 and stats['size'] == 4 and stats['misses'] == len(receivers), stats
+D.Memo.clear_shared_secrets()
+assert D.Memo.shared_secret_stats()['size'] == 0
+D.Memo.set_shared_secret_capacity(4096)
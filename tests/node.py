@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+"""Minimal stand-in for a DCore node speaking the fc websocket JSON-RPC protocol.
+
+Every call is answered after a fixed latency, so the bindings can be exercised
+without a live network. Run standalone or start it in a thread with Node.start().
+"""
+import sys, json, asyncio, threading
+import websockets
+
+CHAIN_ID = '17401602b201b3c45a3ad98afc6fb458f91f519bd30d1058adf6f2bed66376bc'
+SIGNING_KEY = 'DCT7SgGZgKt6KWMJMiHmaMxw99mkfqMGLAywRfbPNKB4GV7tSr3BK'
+HEAD_BLOCK = 1000
+
+def block_id(num):
+    return '%08x' % num + '0' * 32
+
+def block(num):
+    return {
+        'previous': block_id(num - 1),
+        'timestamp': '2020-01-01T00:00:00',
+        'miner': '1.4.1',
+        'transaction_merkle_root': '0' * 40,
+        'extensions': [],
+        'miner_signature': '0' * 130,
+        'transactions': [],
+        'block_id': block_id(num),
+        'signing_key': SIGNING_KEY,
+        'transaction_ids': [],
+        'miner_reward': 0,
+    } if 0 < num <= HEAD_BLOCK else None
+
+def dynamic_global_properties():
+    return {
+        'id': '2.1.0',
+        'head_block_number': HEAD_BLOCK,
+        'head_block_id': block_id(HEAD_BLOCK),
+        'time': '2020-01-01T00:00:00',
+        'current_miner': '1.4.1',
+        'next_maintenance_time': '2020-01-01T01:00:00',
+        'last_budget_time': '2020-01-01T00:00:00',
+        'last_irreversible_block_num': HEAD_BLOCK - 15,
+    }
+
+ACCOUNTS = 1000
+
+def lookup_accounts(lowerbound, limit):
+    names = ['account-%04d' % i for i in range(ACCOUNTS)]
+    return [[name, '1.2.%d' % (i + 15)] for i, name in enumerate(names) if name >= lowerbound][:limit]
+
+APIS = ('database', 'network_broadcast', 'history', 'crypto', 'messaging', 'monitoring', 'network_node')
+
+class Node:
+    def __init__(self, port = 8090, latency = 0.05):
+        self.port = port
+        self.latency = latency
+        self.handlers = {
+            'login': lambda *args: True,
+            'get_chain_id': lambda *args: CHAIN_ID,
+            'get_chain_properties': lambda *args: { 'id': '2.11.0', 'chain_id': CHAIN_ID },
+            'get_dynamic_global_properties': lambda *args: dynamic_global_properties(),
+            'get_block': lambda num: block(num),
+            'lookup_accounts': lookup_accounts,
+            'broadcast_transaction': lambda *args: None,
+            'set_block_applied_callback': self.subscribe,
+        }
+        self.subscribers = []
+        for i, api in enumerate(APIS):
+            self.handlers[api] = lambda *args, i = i: i + 2
+
+    @property
+    def endpoint(self):
+        return f'ws://127.0.0.1:{self.port}'
+
+    def subscribe(self, callback):
+        self.subscribers.append((self.ws, callback))
+
+    async def reply(self, ws, request):
+        await asyncio.sleep(self.latency)
+        api, method, params = request['params']
+        handler = self.handlers.get(method, lambda *args: None)
+        self.ws = ws
+        try:
+            reply = { 'result': handler(*params) }
+        except Exception as e:
+            # handler failures are reported as fc exceptions
+            message = f'{type(e).__name__}: {e}'
+            reply = { 'error': { 'code': 1, 'message': message, 'data': { 'code': 0, 'name': 'exception', 'message': message, 'stack': [] } } }
+        await ws.send(json.dumps(dict(id = request['id'], jsonrpc = '2.0', **reply)))
+
+    async def notify(self, num):
+        for ws, callback in self.subscribers:
+            await ws.send(json.dumps({ 'method': 'notice', 'params': [callback, [block_id(num)]] }))
+
+    def produce(self, num):
+        """Sends the block applied notice of block num to the subscribed connections."""
+        asyncio.run_coroutine_threadsafe(self.notify(num), self.loop).result()
+
+    async def serve(self, ws, path = None):
+        async for message in ws:
+            asyncio.ensure_future(self.reply(ws, json.loads(message)))
+
+    def run(self, started = None):
+        loop = self.loop = asyncio.new_event_loop()
+        asyncio.set_event_loop(loop)
+        loop.run_until_complete(websockets.serve(self.serve, '127.0.0.1', self.port))
+        if started:
+            started.set()
+        loop.run_forever()
+
+    def start(self):
+        started = threading.Event()
+        threading.Thread(target = self.run, args = (started,), daemon = True).start()
+        started.wait()
+        return self
+
+if __name__ == '__main__':
+    Node(int(sys.argv[1]) if len(sys.argv) > 1 else 8090).run()
@@ -0,0 +1,26 @@
+import DCore as D
+
+ops = D.build_transfers([19] * 3000, range(20, 3020), [1] * 3000, D.CORE_ASSET_ID, ['x' * (i % 50) for i in range(3000)])
+trx = D.SignedTransaction()
+trx.operations = ops[:10]
+assert trx.packed_size() == D.Transaction.packed_size(trx) + 1
+trx.sign(D.PrivateKey.generate(), D.SHA256('17401602b201b3c45a3ad98afc6fb458f91f519bd30d1058adf6f2bed66376bc'))
+assert trx.packed_size() == D.Transaction.packed_size(trx) + 1 + 65
+
+max_size = 2048
+for signatures in (0, 1, 3):
+    trxs = D.pack_operations(ops, max_size, signatures)
+    assert sum(len(t.operations) for t in trxs) == len(ops)
+    assert [repr(op) for t in trxs for op in t.operations][:5] == [repr(op) for op in ops[:5]]
+    for t in trxs:
+        assert t.packed_size() + 65 * signatures <= max_size
+    # greedy packing leaves no room for the next operation
+    for t, n in zip(trxs, trxs[1:]):
+        assert t.packed_size() + 65 * signatures + n.operations[0].packed_size() > max_size - 2
+    print(f'{signatures} signatures: {len(ops)} operations in {len(trxs)} transactions')
+
+try:
+    D.pack_operations(ops[:1], 10)
+    assert False
+except ValueError:
+    pass
@@ -0,0 +1,30 @@
+import sys, os, time, tempfile, threading
+import DCore as D
+from node import Node
+
+threads = int(sys.argv[1]) if len(sys.argv) > 1 else 8
+calls = 20
+
+node = Node(latency = 0.05).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+
+# every thread fetches blocks of its own, so no two calls are alike
+def worker(first):
+    for num in range(first, first + calls):
+        w.get_block(num)
+
+def run(count):
+    workers = [threading.Thread(target = worker, args = (1 + i * calls,)) for i in range(count)]
+    start = time.time()
+    for t in workers:
+        t.start()
+    for t in workers:
+        t.join()
+    return time.time() - start
+
+single = run(1)
+parallel = run(threads)
+speedup = threads * single / parallel
+print(f'1 thread: {single:.2f}s, {threads} threads: {parallel:.2f}s, speedup {speedup:.1f}x')
+assert speedup > threads * 0.7, 'blocking queries do not run in parallel'
@@ -0,0 +1,26 @@
+import os, tempfile, threading
+import DCore as D
+from node import Node
+
+nodes = [Node(port = 8091, latency = 0.02).start(), Node(port = 8092, latency = 0.02).start()]
+w = D.Wallet()
+w.connect_pool(os.path.join(tempfile.mkdtemp(), 'wallet.json'), [n.endpoint for n in nodes], connections = 2, strategy = 'round_robin')
+
+status = w.pool_status()
+assert len(status) == 4, status
+assert status[0]['server'] == nodes[0].endpoint
+
+def worker():
+    for num in range(1, 21):
+        w.get_block(num)
+
+workers = [threading.Thread(target = worker) for i in range(8)]
+for t in workers:
+    t.start()
+for t in workers:
+    t.join()
+
+status = w.pool_status()
+assert all(c['healthy'] and c['requests'] > 0 and c['outstanding'] == 0 for c in status), status
+assert sum(c['requests'] for c in status) >= 160, status
+print('pool ok')
@@ -0,0 +1,28 @@
+import os, time, tempfile
+import DCore as D
+import node as N
+from node import Node
+
+node = Node(latency = 0.01).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+
+provider = w.reference_block_provider(refresh = 0.1, expiration = 30)
+assert provider.block_num == N.HEAD_BLOCK - 15, provider.block_num
+
+w.reset_stats()
+trxs = [D.SignedTransaction() for i in range(1000)]
+provider.stamp_all(trxs)
+provider.stamp(trxs[0])
+calls = sum(s['calls'] for s in w.stats().values())
+assert calls < 10, f'{calls} requests for {len(trxs)} transactions'
+assert all(trx.ref_block_num == (N.HEAD_BLOCK - 15) & 0xffff for trx in trxs)
+assert 30 <= trxs[0].expiration.sec_since_epoch() - 1577836800 <= 31
+
+N.HEAD_BLOCK += 10
+time.sleep(0.5)
+assert provider.block_num == N.HEAD_BLOCK - 15 and provider.refreshes > 1
+
+head = w.reference_block_provider(irreversible = False)
+assert head.block_num == N.HEAD_BLOCK
+print('reference block ok')
@@ -0,0 +1,54 @@
+"""Records a workload against a node and replays it offline to measure the bindings.
+
+   python3 replay_benchmark.py record <file> [endpoint]   - the stand-in node when omitted
+   python3 replay_benchmark.py replay <file> [latency]
+"""
+import sys, os, time, tempfile, threading
+import DCore as D
+
+BLOCKS = 200
+ACCOUNTS = [D.AccountId(D.ObjectId(1, 2, i)) for i in range(15, 65)]
+
+def workload(w):
+    results = {}
+
+    start = time.time()
+    for num in range(1, BLOCKS + 1):
+        w.get_block(num)
+    results['get_block'] = BLOCKS / (time.time() - start)
+
+    start = time.time()
+    w.get_blocks(1, BLOCKS, 32)
+    results['get_blocks'] = BLOCKS / (time.time() - start)
+
+    start = time.time()
+    for i in range(BLOCKS):
+        w.get_accounts(ACCOUNTS)
+    results['get_accounts'] = BLOCKS / (time.time() - start)
+
+    trxs = [D.SignedTransaction() for i in range(BLOCKS)]
+    start = time.time()
+    w.broadcast_transactions(trxs, 32)
+    results['broadcast'] = BLOCKS / (time.time() - start)
+    return results
+
+def report(results):
+    for name, rate in results.items():
+        print(f'{name:>14}: {rate:10.0f} calls/s')
+
+w = D.Wallet()
+mode, path = sys.argv[1], sys.argv[2]
+if mode == 'record':
+    if len(sys.argv) > 3:
+        endpoint = sys.argv[3]
+    else:
+        from node import Node
+        endpoint = Node(latency = 0.01).start().endpoint
+    w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), endpoint)
+    w.coalesce = False
+    w.start_recording(path)
+    report(workload(w))
+    w.stop_recording()
+else:
+    w.replay(path, float(sys.argv[3]) if len(sys.argv) > 3 else 0.0)
+    report(workload(w))
@@ -0,0 +1,44 @@
+import time
+import DCore as D
+
+chain_id = D.SHA256('17401602b201b3c45a3ad98afc6fb458f91f519bd30d1058adf6f2bed66376bc')
+trx = D.SignedTransaction()
+trx.add_transfers(range(19, 219), range(20, 220), [1] * 200, D.CORE_ASSET_ID, ['memo %d' % i for i in range(200)])
+trx.sign(D.PrivateKey.generate(), chain_id)
+block = D.SignedBlock()
+block.sign(D.PrivateKey.generate())
+
+for name, obj in (('transaction', trx), ('block', block)):
+    count = 200
+    start = time.time()
+    for i in range(count):
+        data = obj.to_bytes()
+    raw = time.time() - start
+    start = time.time()
+    for i in range(count):
+        text = repr(obj)
+    json = time.time() - start
+    print(f'{name}: to_bytes {raw / count * 1e6:.0f} us, {len(data)} bytes; json {json / count * 1e6:.0f} us, {len(text)} bytes')
+
+    copy = type(obj).from_bytes(data)
+    assert repr(copy) == repr(obj) and copy.to_bytes() == data
+
+assert len(trx.to_bytes()) == trx.packed_size()
+op = trx.operations[0]
+assert repr(D.Operation.from_bytes(op.to_bytes())) == repr(op)
+assert repr(D.Operation.Transfer.from_bytes(op.transfer.to_bytes())) == repr(op.transfer)
+assert repr(D.Memo.from_bytes(bytearray(op.transfer.memo.to_bytes()))) == repr(op.transfer.memo)
+
+try:
+    D.SignedBlock.from_bytes(b'\x01')
+    assert False
+except D.Exception:
+    pass
+
+# the whole buffer is consumed, trailing data is an error too
+try:
+    D.SignedBlock.from_bytes(block.to_bytes() + b'\x00')
+    assert False
+except D.Exception:
+    pass
+assert repr(D.SignedBlock.from_bytes(memoryview(block.to_bytes()))) == repr(block)
@@ -0,0 +1,35 @@
+import time
+import DCore as D
+
+chain_id = D.SHA256('17401602b201b3c45a3ad98afc6fb458f91f519bd30d1058adf6f2bed66376bc')
+keys = [D.PrivateKey.generate() for i in range(2)]
+trxs = [D.SignedTransaction() for i in range(2000)]
+for i, trx in enumerate(trxs):
+    trx.ref_block_num = i
+
+signed = D.sign_transactions(trxs, keys, chain_id)
+for trx, result in zip(trxs[:10], signed):
+    for key in keys:
+        trx.sign(key, chain_id)
+    assert repr(trx.signatures) == repr(result.signatures)
+
+per_trx = D.sign_transactions(trxs[:2], [[keys[0]], [keys[1]]], chain_id)
+assert [len(t.signatures) for t in per_trx] == [1, 1]
+
+trx = D.SignedTransaction()
+many = [D.PrivateKey.generate() for i in range(8)]
+signatures = trx.sign_many(many + many[:3], chain_id)
+assert len(signatures) == 8 and len(trx.signatures) == 8
+
+recovered = trx.get_signature_keys(chain_id)
+assert len(set(str(k) for k in recovered)) == 8 and None not in recovered
+
+block = D.SignedBlock()
+block.sign(keys[0])
+result = block.verify_all(chain_id)
+assert result['recoverable'] and block.validate_signee(result['signee']) and result['transactions'] == []
+
+for threads in (1, 0):
+    start = time.time()
+    D.sign_transactions(trxs, keys, chain_id, threads)
+    print(f'threads={threads or "all"}: {len(trxs) / (time.time() - start):.0f} trx/s')
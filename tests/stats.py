@@ -0,0 +1,27 @@
+import os, tempfile
+import DCore as D
+from node import Node
+
+latency = 0.02
+node = Node(latency = latency).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+w.reset_stats()
+
+for num in range(1, 51):
+    w.get_block(num)
+w.get_block(0)
+
+stats = w.stats()['get_block']
+assert stats['api'] == 'database'
+assert stats['calls'] == 51 and stats['errors'] == 0, stats
+assert stats['bytes_sent'] == 51 * 4 and stats['bytes_received'] > 0, stats
+assert latency <= stats['latency']['p50'] <= stats['latency']['p99'] <= stats['latency']['max'], stats
+
+text = w.stats_prometheus()
+assert 'dcore_rpc_calls_total{api="database",method="get_block"} 51' in text, text
+assert 'dcore_rpc_latency_seconds_count{api="database",method="get_block"} 51' in text, text
+
+w.reset_stats()
+assert w.stats()['get_block']['calls'] == 0
+print('stats ok')
@@ -0,0 +1,55 @@
+import os, time, tempfile, threading
+import DCore as D
+from node import Node, HEAD_BLOCK
+
+node = Node(latency = 0.01).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+
+blocks = []
+irreversible = []
+done = threading.Event()
+
+def on_block(num, block_id):
+    blocks.append(num)
+    if num == HEAD_BLOCK:
+        done.set()
+
+blocks_sub = w.subscribe_blocks(on_block)
+irreversible_sub = w.subscribe_irreversible(lambda num: irreversible.append(num))
+
+for num in range(HEAD_BLOCK - 9, HEAD_BLOCK + 1):
+    node.produce(num)
+
+assert done.wait(5), 'block notifications not delivered'
+assert blocks == list(range(HEAD_BLOCK - 9, HEAD_BLOCK + 1)), blocks
+assert blocks_sub.dropped == 0
+
+time.sleep(0.5)
+assert irreversible and irreversible[0] == HEAD_BLOCK - 15, irreversible
+
+# a slow consumer only sees the latest block when coalescing
+latest = []
+slow = w.subscribe_blocks(lambda num, block_id: (time.sleep(0.1), latest.append(num)), coalesce = True)
+for num in range(1, 11):
+    node.produce(num)
+time.sleep(0.5)
+assert latest[-1] == 10 and len(latest) < 10, latest
+assert slow.dropped > 0
+
+# dropping the last reference from the callback itself
+holder = {}
+released = threading.Event()
+def drop(num, block_id):
+    holder.clear()
+    released.set()
+holder['sub'] = w.subscribe_blocks(drop)
+node.produce(11)
+assert released.wait(5)
+node.produce(12)
+time.sleep(0.2)
+
+for s in (blocks_sub, irreversible_sub, slow):
+    s.cancel()
+    assert not s.active
+print('subscriptions ok')
@@ -0,0 +1,51 @@
+import os, time, tempfile
+import DCore as D
+from node import Node
+
+node = Node(latency = 0.01).start()
+w = D.Wallet()
+w.connect(os.path.join(tempfile.mkdtemp(), 'wallet.json'), node.endpoint)
+w.get_block(1, timeout = 1)
+
+node.latency = 1
+start = time.time()
+try:
+    w.get_block(2, timeout = 0.1)
+    assert False, 'no timeout'
+except D.Timeout as e:
+    assert isinstance(e, TimeoutError) and isinstance(e, D.Exception)
+assert time.time() - start < 0.5
+
+# the default timeout of the wallet and a deadline spanning several calls
+w.timeout = 0.1
+try:
+    w.get_dynamic_global_properties()
+    assert False, 'no timeout'
+except D.Timeout:
+    pass
+
+w.timeout = 0
+node.latency = 0.05
+start = time.time()
+try:
+    with D.Deadline(0.12):
+        for num in range(1, 10):
+            w.get_block(num)
+    assert False, 'no timeout'
+except D.Timeout:
+    pass
+assert time.time() - start < 0.3
+
+# prefetched requests keep the deadline of the call that sent them
+w.timeout = 0.2
+node.latency = 1
+blocks = w.iter_blocks(100, 110, window = 4)
+for expected in (0.2, 0):
+    start = time.time()
+    try:
+        next(blocks)
+        assert False, 'no timeout'
+    except D.Timeout:
+        pass
+    assert time.time() - start < expected + 0.1
+print('timeouts ok')
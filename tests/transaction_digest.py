@@ -0,0 +1,42 @@
+import time
+import DCore as D
+
+chain_id = D.SHA256('17401602b201b3c45a3ad98afc6fb458f91f519bd30d1058adf6f2bed66376bc')
+trx = D.SignedTransaction()
+trx.add_transfers(range(19, 119), range(20, 120), [1] * 100, D.CORE_ASSET_ID)
+
+first = repr(trx.id)
+start = time.time()
+for i in range(10000):
+    trx.id
+print(f'cached id: {10000 / (time.time() - start):.0f} reads/s')
+assert repr(trx.id) == first
+
+# every mutation gives a new version
+def changed(mutate):
+    before = (repr(trx.id), repr(trx.digest()), repr(trx.signature_digest(chain_id)))
+    mutate()
+    after = (repr(trx.id), repr(trx.digest()), repr(trx.signature_digest(chain_id)))
+    return all(b != a for b, a in zip(before, after))
+
+assert changed(lambda: setattr(trx, 'ref_block_num', 7))
+assert changed(lambda: setattr(trx, 'ref_block_prefix', 7))
+assert changed(lambda: setattr(trx, 'expiration', D.TimePointSec(1600000000)))
+assert changed(lambda: setattr(trx, 'operations', trx.operations[:50]))
+assert changed(lambda: trx.add_transfers([1], [2], [3], D.CORE_ASSET_ID))
+assert changed(lambda: trx.set_reference_block(D.RIPEMD160('00000100' + '0' * 32)))
+
+copy = D.SignedTransaction()
+copy.operations = trx.operations
+copy.ref_block_num = trx.ref_block_num
+copy.ref_block_prefix = trx.ref_block_prefix
+copy.expiration = trx.expiration
+assert repr(copy.id) == repr(trx.id)
+
+# signing and key recovery take the cached signature digest
+key = D.PrivateKey.generate()
+trx.ref_block_num = 9
+assert repr(trx.sign(key, chain_id)) == repr(D.calculate_signature(trx, key, chain_id))
+signed = D.sign_transactions([trx], [key], chain_id)[0]
+assert repr(signed.signature_digest(chain_id)) == repr(trx.signature_digest(chain_id))
+assert len(set(repr(k) for k in signed.get_signature_keys(chain_id))) == 1
@@ -0,0 +1,26 @@
+import time
+import DCore as D
+
+count = 50000
+ops = D.build_transfers([19] * count, range(20, 20 + count), [1] * count, D.CORE_ASSET_ID)
+bad = D.build_transfers([19], [20], [-1], D.CORE_ASSET_ID)[0]
+ops[10] = bad
+trx = D.SignedTransaction()
+trx.operations = [bad]
+
+start = time.time()
+for op in ops[:5000]:
+    try:
+        op.validate()
+    except D.Exception:
+        pass
+print(f'serial: {5000 / (time.time() - start):.0f} ops/s')
+
+for threads in (1, 0):
+    start = time.time()
+    results = D.validate_all(ops, threads)
+    print(f'threads={threads or "all"}: {count / (time.time() - start):.0f} ops/s')
+    assert isinstance(results[10], D.Exception) and results.count(None) == count - 1
+
+results = D.validate_all([ops[0], trx, D.SignedTransaction()])
+assert results[0] is None and isinstance(results[1], D.Exception) and isinstance(results[2], D.Exception), results